@@ -33,6 +33,11 @@ namespace {
 
 auto outputs_are_not_broadcastable(const std::shared_ptr<const Node>& node) -> bool {
     auto outputs = node->outputs();
+    if (outputs.size() == 1)
+        return false;
+    // broadcastability of dynamic outputs can't be proven before the actual shapes are known
+    if (std::any_of(outputs.begin(), outputs.end(), [](const Output<const Node>& out) { return out.get_partial_shape().is_dynamic(); }))
+        return true;
     auto find_smallest_output_shape = [](const std::vector<Output<const Node>>& outputs) -> Shape {
         return std::accumulate(std::begin(outputs), std::end(outputs), ngraph::Shape(outputs.begin()->get_shape()),
             [](Shape& other_shape, const Output<const Node>& output){
@@ -121,7 +126,8 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
     auto supported = [](descriptor::Tensor& t) -> bool {
         static const std::set<ngraph::element::Type> supported_data_types =
                 { ngraph::element::f32, ngraph::element::i32, ngraph::element::bf16, ngraph::element::i8, ngraph::element::u8 };
-        return t.get_partial_shape().is_static() && supported_data_types.count(t.get_element_type()) != 0;
+        // dynamic dimensions are resolved by the plugin at runtime, but the rank must be known for the canonicalization
+        return t.get_partial_shape().rank().is_static() && supported_data_types.count(t.get_element_type()) != 0;
     };
     const auto & inputs = n->inputs();
     const auto & outputs = n->outputs();
@@ -15,6 +15,10 @@ namespace pass {
 
 /**
  * @brief Hash transformation calculates hash value for ov::Model
+ *
+ * The hash covers the operations with their attributes, the connections, the element types and shapes, the tensor
+ * names, the runtime information and the constants data. The model is walked directly without serialization, the
+ * constants data is hashed in parallel and the hashes of the large IR weights views are reused between the runs.
  */
 class NGRAPH_API Hash : public ov::pass::ModelPass {
 public:
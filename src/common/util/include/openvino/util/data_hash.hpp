@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Size of the independent blocks used by the chunked data hash.
+ * Each chunk is hashed separately, so the chunks can be processed in parallel by the caller.
+ */
+constexpr size_t data_hash_chunk_size = static_cast<size_t>(1) << 20;
+
+/**
+ * @brief Computes 64-bit hash (XXH64 algorithm) of a contiguous memory region.
+ * Processes 32 bytes per iteration in four independent lanes, that is several times faster than any byte-wise
+ * table driven checksum.
+ * @param data Pointer to the data, may be unaligned
+ * @param size Size of the data in bytes
+ * @param seed Initial value of the hash
+ * @return Hash value. It depends on the platform endianness, so it must not be persisted and shared between platforms.
+ */
+uint64_t hash_data_chunk(const void* data, size_t size, uint64_t seed = 0);
+
+/**
+ * @brief Combines hashes of the consecutive data_hash_chunk_size blocks into a hash of the whole buffer
+ * @param chunk_hashes Hashes of the chunks computed with hash_data_chunk(chunk_ptr, chunk_size, chunk_index)
+ * @param chunks_count Number of chunks
+ * @param size Total size of the data in bytes
+ * @return Hash value equal to the one returned by hash_data for the same buffer
+ */
+uint64_t combine_chunk_hashes(const uint64_t* chunk_hashes, size_t chunks_count, size_t size);
+
+/**
+ * @brief Returns number of data_hash_chunk_size blocks the buffer of the given size is split into
+ */
+inline size_t data_hash_chunks_count(size_t size) {
+    return size == 0 ? 1 : (size + data_hash_chunk_size - 1) / data_hash_chunk_size;
+}
+
+/**
+ * @brief Computes hash of a memory region sequentially using the chunked scheme, so the result is the same
+ * as the one of the parallel computation with hash_data_chunk/combine_chunk_hashes.
+ * @param data Pointer to the data, may be unaligned
+ * @param size Size of the data in bytes
+ * @return Hash value
+ */
+uint64_t hash_data(const void* data, size_t size);
+
+}  // namespace util
+}  // namespace ov
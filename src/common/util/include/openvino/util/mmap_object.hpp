@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Read-only memory mapping of a file. The mapping is released when the object is destroyed.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    /**
+     * @brief Returns pointer to the mapped data, the pointer is aligned to the page size
+     */
+    virtual char* data() noexcept = 0;
+
+    /**
+     * @brief Returns size of the mapped data in bytes
+     */
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file to memory with read-only access
+ * @param path Path to the file
+ * @return Mapped memory object
+ * @throws std::runtime_error if the file can not be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+/**
+ * @brief Maps the whole file with the wide char path to memory with read-only access
+ * @param path Path to the file
+ * @return Mapped memory object
+ * @throws std::runtime_error if the file can not be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/data_hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+constexpr uint64_t prime64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t prime64_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t prime64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t prime64_5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t round64(uint64_t acc, uint64_t input) {
+    acc += input * prime64_2;
+    acc = rotl64(acc, 31);
+    return acc * prime64_1;
+}
+
+inline uint64_t merge_round64(uint64_t acc, uint64_t val) {
+    acc ^= round64(0, val);
+    return acc * prime64_1 + prime64_4;
+}
+
+}  // namespace
+
+uint64_t ov::util::hash_data_chunk(const void* data, size_t size, uint64_t seed) {
+    const auto* p = static_cast<const uint8_t*>(data);
+    const uint8_t* const end = p + size;
+    uint64_t h64;
+
+    if (size >= 32) {
+        const uint8_t* const limit = end - 32;
+        uint64_t v1 = seed + prime64_1 + prime64_2;
+        uint64_t v2 = seed + prime64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime64_1;
+        // four independent lanes are processed in parallel by the CPU pipeline
+        do {
+            v1 = round64(v1, read64(p));
+            v2 = round64(v2, read64(p + 8));
+            v3 = round64(v3, read64(p + 16));
+            v4 = round64(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h64 = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        h64 = merge_round64(h64, v1);
+        h64 = merge_round64(h64, v2);
+        h64 = merge_round64(h64, v3);
+        h64 = merge_round64(h64, v4);
+    } else {
+        h64 = seed + prime64_5;
+    }
+
+    h64 += static_cast<uint64_t>(size);
+
+    while (p + 8 <= end) {
+        h64 ^= round64(0, read64(p));
+        h64 = rotl64(h64, 27) * prime64_1 + prime64_4;
+        p += 8;
+    }
+    if (p + 4 <= end) {
+        h64 ^= static_cast<uint64_t>(read32(p)) * prime64_1;
+        h64 = rotl64(h64, 23) * prime64_2 + prime64_3;
+        p += 4;
+    }
+    while (p < end) {
+        h64 ^= (*p) * prime64_5;
+        h64 = rotl64(h64, 11) * prime64_1;
+        p++;
+    }
+
+    h64 ^= h64 >> 33;
+    h64 *= prime64_2;
+    h64 ^= h64 >> 29;
+    h64 *= prime64_3;
+    h64 ^= h64 >> 32;
+    return h64;
+}
+
+uint64_t ov::util::combine_chunk_hashes(const uint64_t* chunk_hashes, size_t chunks_count, size_t size) {
+    if (chunks_count == 1) {
+        return chunk_hashes[0];
+    }
+    return hash_data_chunk(chunk_hashes, chunks_count * sizeof(uint64_t), static_cast<uint64_t>(size));
+}
+
+uint64_t ov::util::hash_data(const void* data, size_t size) {
+    const auto* p = static_cast<const uint8_t*>(data);
+    const size_t chunks_count = data_hash_chunks_count(size);
+    if (chunks_count == 1) {
+        return hash_data_chunk(p, size, 0);
+    }
+    std::vector<uint64_t> chunk_hashes(chunks_count);
+    for (size_t i = 0; i < chunks_count; i++) {
+        const size_t offset = i * data_hash_chunk_size;
+        chunk_hashes[i] = hash_data_chunk(p + offset, std::min(data_hash_chunk_size, size - offset), i);
+    }
+    return combine_chunk_hashes(chunk_hashes.data(), chunks_count, size);
+}
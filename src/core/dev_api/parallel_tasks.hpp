@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+
+/**
+ * @brief Returns number of the CPUs the process is allowed to run on (the affinity mask set by taskset, numactl or
+ * cgroups on Linux), at least one
+ */
+OPENVINO_API size_t get_available_cpus_count();
+
+/**
+ * @brief Calls task(0) ... task(count - 1) on the worker threads started for this call, the calling thread takes
+ * part in the work too. The workers are joined before the function returns, no threads are kept between the calls.
+ *
+ * The number of the workers of all the calls running at the same time (e.g. the nested calls or the calls of the
+ * different threads) is limited by get_available_cpus_count() - 1, the tasks which don't get a worker are executed
+ * in the calling thread, so the cores are never oversubscribed. The first exception thrown by a task is rethrown
+ * after all the tasks are finished.
+ */
+OPENVINO_API void run_parallel_tasks(size_t count, const std::function<void(size_t)>& task);
+
+}  // namespace ov
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include "openvino/core/runtime_attribute.hpp"
 #include "openvino/pass/pass.hpp"
 
@@ -26,6 +28,21 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Folds the sub-graphs which consist of nodes with constant inputs only. Independent nodes are
+    /// evaluated concurrently, single consumers of the folded nodes are evaluated in the same task without
+    /// creating intermediate constants in the graph.
+    bool constant_subgraphs_folding(const std::shared_ptr<ov::Model>& model);
+
+private:
+    void revalidate(const std::shared_ptr<Node>& node);
+    void mark_consumers_for_revalidation(const Output<Node>& output);
+
+    // The state of the model being folded, it is reset at the end of each run_on_model call.
+    // Nodes which inputs were replaced or changed their types or shapes since the last validation.
+    // The pointers are used as keys only and are never dereferenced.
+    std::unordered_set<const Node*> m_nodes_to_revalidate;
+    // Nodes which failed to fold with constant inputs, so folding them again is useless
+    std::unordered_set<const Node*> m_not_foldable;
 };
 
 /**
@@ -17,6 +17,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/descriptor/input.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "shared_node_info.hpp"
@@ -825,12 +826,17 @@ bool ov::Node::constant_fold(OutputVector& output_values, const OutputVector& in
     if (!all_constants)
         return false;
 
+    // Input tensors view the constants data directly, evaluate never writes to its inputs
     TensorVector input_tensors;
     for (const auto& input : input_values) {
         auto constant = ov::as_type_ptr<ngraph::op::v0::Constant>(input.get_node_shared_ptr());
-        auto tensor = ov::Tensor(input.get_element_type(), input.get_shape());
-        std::copy_n(constant->get_data_ptr<uint8_t>(), constant->get_byte_size(), static_cast<uint8_t*>(tensor.data()));
-        input_tensors.push_back(tensor);
+        if (constant->get_byte_size() == 0) {
+            input_tensors.emplace_back(input.get_element_type(), input.get_shape());
+        } else {
+            input_tensors.emplace_back(input.get_element_type(),
+                                       input.get_shape(),
+                                       const_cast<void*>(constant->get_data_ptr()));
+        }
     }
 
     TensorVector output_tensors;
@@ -841,9 +847,18 @@ bool ov::Node::constant_fold(OutputVector& output_values, const OutputVector& in
     OPENVINO_SUPPRESS_DEPRECATED_START
     if (evaluate(output_tensors, input_tensors)) {
         for (size_t i = 0; i < output_tensors.size(); ++i) {
-            output_values[i] = make_shared<ngraph::op::Constant>(output_tensors[i].get_element_type(),
-                                                                 output_tensors[i].get_shape(),
-                                                                 output_tensors[i].data());
+            const auto& tensor = output_tensors[i];
+            if (tensor.get_byte_size() == 0) {
+                output_values[i] =
+                    make_shared<ngraph::op::Constant>(tensor.get_element_type(), tensor.get_shape(), tensor.data());
+                continue;
+            }
+            // The result Constant owns the evaluated tensor instead of copying its data
+            auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<ov::Tensor>>(static_cast<char*>(tensor.data()),
+                                                                                      tensor.get_byte_size(),
+                                                                                      tensor);
+            output_values[i] =
+                make_shared<ngraph::op::Constant>(tensor.get_element_type(), tensor.get_shape(), buffer);
         }
         return true;
     }
@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "parallel_tasks.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#    include <sched.h>
+#endif
+#ifndef _WIN32
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace {
+/**
+ * @brief The number of the worker threads which may run at the same time in the process. Only the atomics are used:
+ * a mutex locked by another thread during fork() would stay locked in the child process forever.
+ */
+class WorkersBudget {
+public:
+    static WorkersBudget& get() {
+        static WorkersBudget budget(get_available_cpus_count() - 1);
+        return budget;
+    }
+
+    size_t acquire(size_t wanted) {
+        reset_after_fork();
+        size_t used = m_used.load();
+        size_t granted = 0;
+        do {
+            granted = std::min(wanted, m_limit - std::min(used, m_limit));
+        } while (granted != 0 && !m_used.compare_exchange_weak(used, used + granted));
+        return granted;
+    }
+
+    void release(size_t count) {
+        if (count != 0) {
+            m_used -= count;
+        }
+    }
+
+private:
+    explicit WorkersBudget(size_t limit) : m_limit(limit), m_pid(current_pid()) {}
+
+    static int64_t current_pid() {
+#ifndef _WIN32
+        return static_cast<int64_t>(getpid());
+#else
+        return 0;
+#endif
+    }
+
+    // The workers of the parent process don't exist in the fork() child, their budget is given back
+    void reset_after_fork() {
+        const auto pid = current_pid();
+        auto owner = m_pid.load();
+        if (owner != pid && m_pid.compare_exchange_strong(owner, pid)) {
+            m_used = 0;
+        }
+    }
+
+    const size_t m_limit;
+    std::atomic<size_t> m_used{0};
+    std::atomic<int64_t> m_pid;
+};
+}  // namespace
+
+size_t get_available_cpus_count() {
+#if defined(__linux__)
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+        const int count = CPU_COUNT(&mask);
+        if (count > 0) {
+            return static_cast<size_t>(count);
+        }
+    }
+#endif
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+void run_parallel_tasks(size_t count, const std::function<void(size_t)>& task) {
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    std::atomic<size_t> next{0};
+    auto process = [&]() {
+        for (size_t idx = next++; idx < count; idx = next++) {
+            try {
+                task(idx);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+    };
+
+    auto& budget = WorkersBudget::get();
+    const size_t workers_count = count < 2 ? 0 : budget.acquire(count - 1);
+    std::vector<std::thread> workers;
+    try {
+        workers.reserve(workers_count);
+        for (size_t i = 0; i < workers_count; i++) {
+            workers.emplace_back(process);
+        }
+    } catch (const std::exception&) {
+        // The system is out of the threads, the started workers and the calling thread do all the tasks
+    }
+    budget.release(workers_count - workers.size());
+
+    process();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    budget.release(workers.size());
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+}  // namespace ov
@@ -4,7 +4,9 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <limits>
 #include <openvino/cc/pass/itt.hpp>
+#include <unordered_set>
 
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
@@ -12,6 +14,8 @@
 #include "openvino/op/util/sub_graph_base.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset3.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "parallel_tasks.hpp"
 
 using namespace std;
 
@@ -50,13 +54,212 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+namespace {
+/**
+ * \brief Check if the node may be folded concurrently with other nodes.
+ *
+ * Only the standard operations which are folded by the stateless evaluate are allowed. The exact type is checked,
+ * so the custom operations derived from them are folded sequentially: their constant_fold may evaluate the bounds of
+ * the inputs or connect new nodes to them, both modify the shared input constants.
+ *
+ * \param node  Node to check.
+ *
+ * \return true if node can be folded in a parallel task otherwise false.
+ */
+bool is_parallel_foldable(const std::shared_ptr<ov::Node>& node) {
+    static const std::unordered_set<ov::DiscreteTypeInfo> parallel_foldable_types = {
+        ov::op::v1::Add::get_type_info_static(),
+        ov::op::v1::Subtract::get_type_info_static(),
+        ov::op::v1::Multiply::get_type_info_static(),
+        ov::op::v1::Divide::get_type_info_static(),
+        ov::op::v1::Power::get_type_info_static(),
+        ov::op::v1::Maximum::get_type_info_static(),
+        ov::op::v1::Minimum::get_type_info_static(),
+        ov::op::v1::FloorMod::get_type_info_static(),
+        ov::op::v1::Equal::get_type_info_static(),
+        ov::op::v1::NotEqual::get_type_info_static(),
+        ov::op::v1::Less::get_type_info_static(),
+        ov::op::v1::LessEqual::get_type_info_static(),
+        ov::op::v1::Greater::get_type_info_static(),
+        ov::op::v1::GreaterEqual::get_type_info_static(),
+        ov::op::v1::LogicalAnd::get_type_info_static(),
+        ov::op::v1::LogicalOr::get_type_info_static(),
+        ov::op::v1::LogicalNot::get_type_info_static(),
+        ov::op::v0::Abs::get_type_info_static(),
+        ov::op::v0::Negative::get_type_info_static(),
+        ov::op::v0::Sqrt::get_type_info_static(),
+        ov::op::v0::Exp::get_type_info_static(),
+        ov::op::v0::Log::get_type_info_static(),
+        ov::op::v0::Relu::get_type_info_static(),
+        ov::op::v0::Sigmoid::get_type_info_static(),
+        ov::op::v0::Tanh::get_type_info_static(),
+        ov::op::v0::Floor::get_type_info_static(),
+        ov::op::v0::Ceiling::get_type_info_static(),
+        ov::op::v0::Sign::get_type_info_static(),
+        ov::op::v0::Clamp::get_type_info_static(),
+        ov::op::v0::Convert::get_type_info_static(),
+        ov::op::v0::Concat::get_type_info_static(),
+        ov::op::v0::MatMul::get_type_info_static(),
+        ov::op::v1::Transpose::get_type_info_static(),
+        ov::op::v1::Gather::get_type_info_static(),
+        ov::op::v7::Gather::get_type_info_static(),
+        ov::op::v8::Gather::get_type_info_static(),
+        ov::op::v1::Broadcast::get_type_info_static(),
+        ov::op::v3::Broadcast::get_type_info_static(),
+        ov::op::v0::Tile::get_type_info_static(),
+        ov::op::v1::Select::get_type_info_static(),
+        ov::op::v1::StridedSlice::get_type_info_static(),
+        ov::op::v8::Slice::get_type_info_static(),
+        ov::op::v1::Split::get_type_info_static(),
+        ov::op::v1::VariadicSplit::get_type_info_static(),
+        ov::op::v0::Range::get_type_info_static(),
+        ov::op::v4::Range::get_type_info_static(),
+        ov::op::v1::ReduceSum::get_type_info_static(),
+        ov::op::v1::ReduceMean::get_type_info_static(),
+        ov::op::v1::ReduceMax::get_type_info_static(),
+        ov::op::v1::ReduceMin::get_type_info_static(),
+        ov::op::v1::ReduceProd::get_type_info_static(),
+    };
+    return parallel_foldable_types.count(node->get_type_info()) && !ov::pass::constant_folding_is_disabled(node);
+}
+
+/**
+ * \brief Check if all the node inputs except the input with \p skip_idx index are produced by constants.
+ */
+bool has_constant_inputs(const ov::Node& node, size_t skip_idx = std::numeric_limits<size_t>::max()) {
+    if (node.get_input_size() == 0) {
+        return false;
+    }
+    for (size_t i = 0; i < node.get_input_size(); ++i) {
+        if (i != skip_idx && !ov::is_type<ov::op::v0::Constant>(node.get_input_node_ptr(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// \brief Chain of nodes where each node is the single consumer of the previous one
+struct FoldingTask {
+    std::vector<std::shared_ptr<ov::Node>> chain;
+    // Replacements for the outputs of the last node in the chain, empty if the first node is not folded
+    ov::OutputVector replacements;
+    // Consumer of the last node in the chain which failed to fold
+    std::shared_ptr<ov::Node> not_foldable;
+    std::exception_ptr exception;
+};
+
+/**
+ * \brief Folds the first node of the task and then its single consumers while they have no other non-constant
+ * inputs. Intermediate constants are only passed to constant_fold of the consumer and never connected to the graph.
+ */
+void fold_chain(FoldingTask& task, const std::unordered_set<const ov::Node*>& nodes_to_revalidate) {
+    auto node = task.chain.front();
+    ov::OutputVector replacements(node->get_output_size());
+    if (!node->constant_fold(replacements, node->input_values())) {
+        return;
+    }
+    OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                    "constant_fold_default returned incorrect number of replacements for ",
+                    node);
+
+    while (node->get_output_size() == 1 && ov::is_type<ov::op::v0::Constant>(replacements[0].get_node())) {
+        const auto target_inputs = node->output(0).get_target_inputs();
+        if (target_inputs.size() != 1) {
+            break;
+        }
+        const auto& input = *target_inputs.begin();
+        auto consumer = input.get_node()->shared_from_this();
+        if (!is_parallel_foldable(consumer) || nodes_to_revalidate.count(consumer.get()) ||
+            !has_constant_inputs(*consumer, input.get_index())) {
+            break;
+        }
+
+        auto input_values = consumer->input_values();
+        input_values[input.get_index()] = replacements[0];
+        ov::OutputVector consumer_replacements(consumer->get_output_size());
+        if (!consumer->constant_fold(consumer_replacements, input_values)) {
+            task.not_foldable = consumer;
+            break;
+        }
+        OPENVINO_ASSERT(consumer_replacements.size() == consumer->get_output_size(),
+                        "constant_fold_default returned incorrect number of replacements for ",
+                        consumer);
+        task.chain.push_back(consumer);
+        replacements = std::move(consumer_replacements);
+        node = std::move(consumer);
+    }
+    task.replacements = std::move(replacements);
+}
+
+/**
+ * \brief Runs the tasks on the worker threads, the calling thread takes part in the work.
+ */
+void run_folding_tasks(std::vector<FoldingTask>& tasks, const std::unordered_set<const ov::Node*>& nodes_to_revalidate) {
+    auto run_task = [&](size_t idx) {
+        try {
+            fold_chain(tasks[idx], nodes_to_revalidate);
+        } catch (...) {
+            tasks[idx].exception = std::current_exception();
+        }
+    };
+
+    // A few nodes are folded faster than the tasks are distributed
+    constexpr size_t min_parallel_tasks = 16;
+    if (tasks.size() < min_parallel_tasks) {
+        for (size_t task = 0; task < tasks.size(); task++) {
+            run_task(task);
+        }
+    } else {
+        ov::run_parallel_tasks(tasks.size(), run_task);
+    }
+
+    // Report the same error as the sequential folding would
+    for (const auto& task : tasks) {
+        if (task.exception) {
+            std::rethrow_exception(task.exception);
+        }
+    }
+}
+
+/**
+ * \brief Gives the folding of a model its own empty state and restores the state of the caller at the end, so the
+ * folding of the sub-graph bodies doesn't affect the outer model and no node pointers outlive the run.
+ */
+class ScopedFoldingState {
+public:
+    explicit ScopedFoldingState(std::initializer_list<std::unordered_set<const ov::Node*>*> sets) {
+        for (auto set : sets) {
+            m_saved.emplace_back(set, std::unordered_set<const ov::Node*>{});
+            m_saved.back().second.swap(*set);
+        }
+    }
+
+    ~ScopedFoldingState() {
+        // The state of the finished run is released together with this object
+        for (auto& saved : m_saved) {
+            saved.first->swap(saved.second);
+        }
+    }
+
+private:
+    std::vector<std::pair<std::unordered_set<const ov::Node*>*, std::unordered_set<const ov::Node*>>> m_saved;
+};
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
+    ScopedFoldingState state{&m_nodes_to_revalidate, &m_not_foldable};
     bool rewritten = pre_calculated_values_folding(model);
+    rewritten |= constant_subgraphs_folding(model);
 
     for (const auto& node : model->get_ordered_ops()) {
-        if (rewritten) {
-            node->validate_and_infer_types();
+        // Only the nodes which inputs were changed are validated again
+        const bool inputs_changed = m_nodes_to_revalidate.erase(node.get()) != 0;
+        if (inputs_changed) {
+            revalidate(node);
+        }
+        if (m_not_foldable.erase(node.get()) && !inputs_changed) {
+            continue;
         }
 
         OutputVector replacements(node->get_output_size());
@@ -78,6 +281,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
                     node_output.replace(replacement);
                     // Propagate runtime info attributes to replacement consumer nodes
                     copy_runtime_info_to_target_inputs(node, replacement);
+                    mark_consumers_for_revalidation(replacement);
 
                     rewritten = true;
                 }
@@ -86,8 +290,13 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
                 size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+                bool sub_graphs_rewritten = false;
                 for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    rewritten |= run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind)));
+                    sub_graphs_rewritten |= run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind)));
+                }
+                if (sub_graphs_rewritten) {
+                    revalidate(node);
+                    rewritten = true;
                 }
             }
         }
@@ -96,6 +305,98 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::constant_subgraphs_folding(const std::shared_ptr<ov::Model>& model) {
+    std::vector<std::shared_ptr<Node>> wave;
+    std::unordered_set<const Node*> scheduled;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (is_parallel_foldable(node) && has_constant_inputs(*node)) {
+            wave.push_back(node);
+            scheduled.insert(node.get());
+        }
+    }
+
+    bool rewritten = false;
+    while (!wave.empty()) {
+        std::vector<FoldingTask> tasks(wave.size());
+        for (size_t i = 0; i < wave.size(); ++i) {
+            if (m_nodes_to_revalidate.erase(wave[i].get())) {
+                revalidate(wave[i]);
+            }
+            tasks[i].chain.push_back(wave[i]);
+        }
+        run_folding_tasks(tasks, m_nodes_to_revalidate);
+
+        // The graph is modified sequentially in the order of the nodes in the wave
+        std::vector<std::shared_ptr<Node>> next_wave;
+        for (auto& task : tasks) {
+            if (task.not_foldable) {
+                // It is validated with the constant input and folded again by the sequential pass
+                scheduled.insert(task.not_foldable.get());
+            }
+            if (task.replacements.empty()) {
+                m_not_foldable.insert(task.chain.front().get());
+                continue;
+            }
+            // Runtime info is merged along the chain in the same way as if the nodes were folded one by one
+            for (size_t i = 1; i < task.chain.size(); ++i) {
+                copy_runtime_info({task.chain[i - 1], task.chain[i]}, task.chain[i]);
+            }
+
+            const auto& node = task.chain.back();
+            for (size_t i = 0; i < task.replacements.size(); ++i) {
+                auto node_output = node->output(i);
+                const auto& replacement = task.replacements[i];
+                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+                    replacement.get_node()->set_friendly_name(friendly_name_from(*node, task.replacements.size(), i));
+
+                    node_output.replace(replacement);
+                    // Propagate runtime info attributes to replacement consumer nodes
+                    copy_runtime_info_to_target_inputs(node, replacement);
+                    mark_consumers_for_revalidation(replacement);
+
+                    rewritten = true;
+
+                    for (const auto& input : replacement.get_target_inputs()) {
+                        auto consumer = input.get_node()->shared_from_this();
+                        if (!scheduled.count(consumer.get()) && is_parallel_foldable(consumer) &&
+                            has_constant_inputs(*consumer)) {
+                            next_wave.push_back(consumer);
+                            scheduled.insert(consumer.get());
+                        }
+                    }
+                }
+            }
+        }
+        wave = std::move(next_wave);
+    }
+    return rewritten;
+}
+
+void ov::pass::ConstantFolding::revalidate(const std::shared_ptr<Node>& node) {
+    std::vector<std::pair<element::Type, PartialShape>> outputs;
+    outputs.reserve(node->get_output_size());
+    for (const auto& output : node->outputs()) {
+        outputs.emplace_back(output.get_element_type(), output.get_partial_shape());
+    }
+
+    node->validate_and_infer_types();
+
+    // The consumers have to be validated again only if the outputs were changed
+    for (const auto& output : node->outputs()) {
+        const auto idx = output.get_index();
+        if (idx >= outputs.size() || outputs[idx].first != output.get_element_type() ||
+            outputs[idx].second != output.get_partial_shape()) {
+            mark_consumers_for_revalidation(output);
+        }
+    }
+}
+
+void ov::pass::ConstantFolding::mark_consumers_for_revalidation(const Output<Node>& output) {
+    for (const auto& input : output.get_target_inputs()) {
+        m_nodes_to_revalidate.insert(input.get_node());
+    }
+}
+
 void ov::pass::ConstantFolding::copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                                    const Output<Node>& replacement) {
     for (auto& input : replacement.get_target_inputs()) {
@@ -153,6 +454,7 @@ bool ov::pass::ConstantFolding::pre_calculated_values_folding(const std::shared_
                     output.replace(replacement);
                     // Propagate runtime info attributes to replacement consumer nodes
                     copy_runtime_info_to_target_inputs(input_node, replacement);
+                    mark_consumers_for_revalidation(replacement);
 
                     rewritten = true;
                 }
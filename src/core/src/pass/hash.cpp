@@ -0,0 +1,404 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/hash.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <openvino/cc/pass/itt.hpp>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/util/data_hash.hpp"
+#include "parallel_tasks.hpp"
+
+namespace ov {
+namespace {
+
+template <typename T>
+uint64_t hash_combine(uint64_t seed, const T& a) {
+    // Hash combine formula from boost
+    return seed ^ (std::hash<T>()(a) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+template <typename T>
+uint64_t hash_combine(uint64_t seed, const std::vector<T>& v) {
+    seed = hash_combine(seed, v.size());
+    for (const auto& item : v) {
+        seed = hash_combine(seed, item);
+    }
+    return seed;
+}
+
+uint64_t hash_combine(uint64_t seed, const Dimension& dim) {
+    seed = hash_combine(seed, dim.get_min_length());
+    return hash_combine(seed, dim.get_max_length());
+}
+
+uint64_t hash_combine(uint64_t seed, const PartialShape& shape) {
+    if (shape.rank().is_dynamic()) {
+        return hash_combine(seed, int64_t{-1});
+    }
+    seed = hash_combine(seed, shape.size());
+    for (const auto& dim : shape) {
+        seed = hash_combine(seed, dim);
+    }
+    return seed;
+}
+
+uint64_t hash_combine(uint64_t seed, const element::Type& type) {
+    return hash_combine(seed, type.hash());
+}
+
+/// \brief Keeps the hashes of the large constant buffers which are views into the IR weights (usually the mapped
+/// weights file). The weights are never written, so the hash is reused while the buffer is alive, e.g. when the same
+/// model is compiled several times.
+class ConstantHashCache {
+public:
+    static ConstantHashCache& get() {
+        static ConstantHashCache cache;
+        return cache;
+    }
+
+    static bool is_cacheable(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+        return buffer->size() >= min_cached_size &&
+               std::dynamic_pointer_cast<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                   buffer);
+    }
+
+    bool find(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer, uint64_t& hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto found = m_entries.find(buffer.get());
+        // The address may be reused by a new buffer after the previous one is destroyed
+        if (found == m_entries.end() || found->second.buffer.lock() != buffer ||
+            found->second.data != buffer->get_ptr() || found->second.size != buffer->size()) {
+            return false;
+        }
+        hash = found->second.hash;
+        return true;
+    }
+
+    void insert(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer, uint64_t hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_entries.size() >= m_sweep_threshold) {
+            for (auto it = m_entries.begin(); it != m_entries.end();) {
+                it = it->second.buffer.expired() ? m_entries.erase(it) : std::next(it);
+            }
+            m_sweep_threshold = std::max(initial_sweep_threshold, 2 * m_entries.size());
+        }
+        m_entries[buffer.get()] = {buffer, buffer->get_ptr(), buffer->size(), hash};
+    }
+
+private:
+    struct Entry {
+        std::weak_ptr<ngraph::runtime::AlignedBuffer> buffer;
+        const void* data;
+        size_t size;
+        uint64_t hash;
+    };
+
+    static constexpr size_t min_cached_size = 64 * 1024;
+    static constexpr size_t initial_sweep_threshold = 1024;
+
+    std::mutex m_mutex;
+    std::unordered_map<const ngraph::runtime::AlignedBuffer*, Entry> m_entries;
+    size_t m_sweep_threshold = initial_sweep_threshold;
+};
+
+constexpr size_t ConstantHashCache::min_cached_size;
+constexpr size_t ConstantHashCache::initial_sweep_threshold;
+
+/// \brief Calculates hash of the model structure walking the operations and their attributes directly instead of
+/// serializing the model. The constant buffers are only collected during the walk and hashed at the end in parallel.
+class ModelHasher {
+public:
+    uint64_t hash_model(const Model& model);
+    uint64_t hash_constants(uint64_t seed);
+
+    void add_constant(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+        m_constants.push_back(buffer);
+    }
+
+private:
+    uint64_t hash_rt_info(uint64_t seed, const RTMap& rt_info);
+
+    std::vector<std::shared_ptr<ngraph::runtime::AlignedBuffer>> m_constants;
+    std::ostringstream m_stream;
+};
+
+class HashAttributeVisitor : public AttributeVisitor {
+public:
+    HashAttributeVisitor(ModelHasher& hasher, uint64_t& seed) : m_hasher(hasher), m_seed(seed) {}
+
+    void on_adapter(const std::string& name, ValueAccessor<void>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        if (const auto& a =
+                as_type<AttributeAdapter<std::vector<std::shared_ptr<op::util::MultiSubGraphOp::InputDescription>>>>(
+                    &adapter)) {
+            for (const auto& input : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(input->get_type_info().name));
+                m_seed = hash_combine(m_seed, input->m_input_index);
+                m_seed = hash_combine(m_seed, input->m_body_parameter_index);
+                if (const auto& slice = as_type_ptr<op::util::MultiSubGraphOp::SliceInputDescription>(input)) {
+                    m_seed = hash_combine(m_seed, std::vector<int64_t>{slice->m_start,
+                                                                       slice->m_stride,
+                                                                       slice->m_part_size,
+                                                                       slice->m_end,
+                                                                       slice->m_axis});
+                } else if (const auto& merged =
+                               as_type_ptr<op::util::MultiSubGraphOp::MergedInputDescription>(input)) {
+                    m_seed = hash_combine(m_seed, merged->m_body_value_index);
+                }
+            }
+        } else if (const auto& a = as_type<
+                       AttributeAdapter<std::vector<std::shared_ptr<op::util::MultiSubGraphOp::OutputDescription>>>>(
+                       &adapter)) {
+            for (const auto& output : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(output->get_type_info().name));
+                m_seed = hash_combine(m_seed, output->m_output_index);
+                m_seed = hash_combine(m_seed, output->m_body_value_index);
+                if (const auto& concat = as_type_ptr<op::util::MultiSubGraphOp::ConcatOutputDescription>(output)) {
+                    m_seed = hash_combine(m_seed, std::vector<int64_t>{concat->m_start,
+                                                                       concat->m_stride,
+                                                                       concat->m_part_size,
+                                                                       concat->m_end,
+                                                                       concat->m_axis});
+                } else if (const auto& body = as_type_ptr<op::util::MultiSubGraphOp::BodyOutputDescription>(output)) {
+                    m_seed = hash_combine(m_seed, body->m_iteration);
+                }
+            }
+        } else if (const auto& a = as_type<AttributeAdapter<op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get().current_iteration_input_idx);
+            m_seed = hash_combine(m_seed, a->get().body_condition_output_idx);
+        } else if (const auto& a = as_type<AttributeAdapter<std::shared_ptr<op::util::Variable>>>(&adapter)) {
+            const auto& info = a->get()->get_info();
+            m_seed = hash_combine(m_seed, info.variable_id);
+            m_seed = hash_combine(m_seed, info.data_shape);
+            m_seed = hash_combine(m_seed, info.data_type);
+        } else if (const auto& a =
+                       as_type<AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            if (const auto& buffer = a->get()) {
+                m_seed = hash_combine(m_seed, buffer->size());
+                m_hasher.add_constant(buffer);
+            }
+        } else if (const auto& a = as_type<AttributeAdapter<op::util::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            m_seed = hash_combine(m_seed, attrs.get_type_name());
+            m_seed = hash_combine(m_seed, attrs.get_opset_name());
+            // the attributes are kept in the unordered map
+            std::vector<std::pair<std::string, std::string>> sorted_attrs(attrs.begin(), attrs.end());
+            std::sort(sorted_attrs.begin(), sorted_attrs.end());
+            for (const auto& attr : sorted_attrs) {
+                m_seed = hash_combine(m_seed, attr.first);
+                m_seed = hash_combine(m_seed, attr.second);
+            }
+        } else if (const auto& a = as_type<AttributeAdapter<element::TypeVector>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get().size());
+            for (const auto& type : a->get()) {
+                m_seed = hash_combine(m_seed, type);
+            }
+        } else if (const auto& a = as_type<AttributeAdapter<PartialShape>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get());
+        } else if (const auto& a = as_type<AttributeAdapter<Dimension>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get());
+        } else {
+            OPENVINO_ASSERT(false, "Unsupported attribute type for hash calculation: ", name);
+        }
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<bool>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::string>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<int64_t>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<double>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<int>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<float>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<std::string>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::shared_ptr<Model>>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, m_hasher.hash_model(*adapter.get()));
+    }
+
+private:
+    template <typename T>
+    void hash_attribute(const std::string& name, const T& value) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    ModelHasher& m_hasher;
+    uint64_t& m_seed;
+};
+
+uint64_t ModelHasher::hash_rt_info(uint64_t seed, const RTMap& rt_info) {
+    for (const auto& item : rt_info) {
+        seed = hash_combine(seed, item.first);
+        if (item.second.empty()) {
+            continue;
+        }
+        if (item.second.is<std::string>()) {
+            seed = hash_combine(seed, item.second.as<std::string>());
+        } else {
+            m_stream.str("");
+            m_stream.clear();
+            item.second.print(m_stream);
+            seed = hash_combine(seed, m_stream.str());
+        }
+    }
+    return seed;
+}
+
+uint64_t ModelHasher::hash_model(const Model& model) {
+    uint64_t seed = 0;
+    // Auto-generated names differ between the instances of the same model, so they are skipped
+    if (model.get_friendly_name() != model.get_name()) {
+        seed = hash_combine(seed, model.get_friendly_name());
+    }
+
+    const auto ordered_ops = model.get_ordered_ops();
+    std::unordered_map<const Node*, size_t> node_ids;
+    node_ids.reserve(ordered_ops.size());
+    for (const auto& node : ordered_ops) {
+        node_ids.emplace(node.get(), node_ids.size());
+    }
+
+    for (const auto& node : ordered_ops) {
+        const auto& type_info = node->get_type_info();
+        seed = hash_combine(seed, std::string(type_info.name));
+        seed = hash_combine(seed, type_info.get_version());
+        if (node->get_friendly_name() != node->get_name()) {
+            seed = hash_combine(seed, node->get_friendly_name());
+        }
+
+        for (const auto& input : node->inputs()) {
+            const auto source = input.get_source_output();
+            seed = hash_combine(seed, node_ids.at(source.get_node()));
+            seed = hash_combine(seed, source.get_index());
+            seed = hash_combine(seed, input.get_element_type());
+            seed = hash_combine(seed, input.get_partial_shape());
+            seed = hash_rt_info(seed, input.get_rt_info());
+        }
+
+        for (const auto& output : node->outputs()) {
+            seed = hash_combine(seed, output.get_element_type());
+            seed = hash_combine(seed, output.get_partial_shape());
+            const auto& names = output.get_tensor().get_names();
+            std::vector<std::string> sorted_names(names.begin(), names.end());
+            std::sort(sorted_names.begin(), sorted_names.end());
+            seed = hash_combine(seed, sorted_names);
+            seed = hash_rt_info(seed, output.get_rt_info());
+        }
+
+        HashAttributeVisitor visitor(*this, seed);
+        OPENVINO_ASSERT(node->visit_attributes(visitor), "Visitor API is not supported in ", node);
+        seed = hash_rt_info(seed, node->get_rt_info());
+    }
+
+    // Order of the model inputs and outputs is not defined by the topological order
+    for (const auto& parameter : model.get_parameters()) {
+        seed = hash_combine(seed, node_ids.at(parameter.get()));
+    }
+    for (const auto& result : model.get_results()) {
+        seed = hash_combine(seed, node_ids.at(result.get()));
+    }
+    for (const auto& sink : model.get_sinks()) {
+        seed = hash_combine(seed, node_ids.at(sink.get()));
+    }
+    return seed;
+}
+
+uint64_t ModelHasher::hash_constants(uint64_t seed) {
+    auto& cache = ConstantHashCache::get();
+    std::vector<uint64_t> hashes(m_constants.size());
+    std::vector<size_t> first_chunks(m_constants.size() + 1, 0);
+    // The chunks of all the constants form one pool of tasks, so a few huge constants are processed
+    // by all the threads as well as a lot of small ones
+    std::vector<std::pair<size_t, size_t>> tasks;
+    size_t total_size = 0;
+    for (size_t i = 0; i < m_constants.size(); i++) {
+        const auto& buffer = m_constants[i];
+        const size_t chunks_count =
+            ConstantHashCache::is_cacheable(buffer) && cache.find(buffer, hashes[i])
+                ? 0
+                : util::data_hash_chunks_count(buffer->size());
+        first_chunks[i + 1] = first_chunks[i] + chunks_count;
+        for (size_t chunk = 0; chunk < chunks_count; chunk++) {
+            tasks.emplace_back(i, chunk);
+        }
+        total_size += chunks_count == 0 ? 0 : buffer->size();
+    }
+
+    std::vector<uint64_t> chunk_hashes(tasks.size());
+    auto hash_chunk = [&](size_t task) {
+        const auto& buffer = m_constants[tasks[task].first];
+        const size_t offset = tasks[task].second * util::data_hash_chunk_size;
+        chunk_hashes[task] = util::hash_data_chunk(buffer->get_ptr<char>() + offset,
+                                                   std::min(util::data_hash_chunk_size, buffer->size() - offset),
+                                                   tasks[task].second);
+    };
+
+    // Small models are hashed faster than the tasks are distributed
+    constexpr size_t min_parallel_size = 4 * util::data_hash_chunk_size;
+    if (total_size < min_parallel_size) {
+        for (size_t task = 0; task < tasks.size(); task++) {
+            hash_chunk(task);
+        }
+    } else {
+        run_parallel_tasks(tasks.size(), hash_chunk);
+    }
+
+    for (size_t i = 0; i < m_constants.size(); i++) {
+        const size_t chunks_count = first_chunks[i + 1] - first_chunks[i];
+        if (chunks_count != 0) {
+            const auto& buffer = m_constants[i];
+            hashes[i] = util::combine_chunk_hashes(&chunk_hashes[first_chunks[i]], chunks_count, buffer->size());
+            if (ConstantHashCache::is_cacheable(buffer)) {
+                cache.insert(buffer, hashes[i]);
+            }
+        }
+        seed = hash_combine(seed, hashes[i]);
+    }
+    return seed;
+}
+
+}  // namespace
+
+bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    RUN_ON_MODEL_SCOPE(Hash);
+    ModelHasher hasher;
+    uint64_t seed = hasher.hash_model(*f);
+    m_hash = hasher.hash_constants(seed);
+    // Return false because we didn't change nGraph Function
+    return false;
+}
+
+pass::Hash::Hash(uint64_t& output_hash_value) : m_hash(output_hash_value) {}
+
+}  // namespace ov
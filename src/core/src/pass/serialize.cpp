@@ -20,7 +20,6 @@
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/util/file_util.hpp"
 #include "pugixml.hpp"
-#include "transformations/hash.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
 using namespace ngraph;
@@ -78,21 +77,24 @@ size_t hash_combine(const void* v, int64_t size) {
     return seed;
 }
 
+// Alignment of the blobs written by StreamSerialize, enough for any element type and vector loads
+constexpr size_t blobs_alignment = 64;
+
 class ConstantWriter {
 public:
     using FilePosition = int64_t;
     using HashValue = size_t;
     using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, size_t alignment = 1)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
+          m_alignment(alignment),
           m_blob_offset(bin_data.tellp()) {}
 
     FilePosition write(const char* ptr, size_t size) {
-        const FilePosition write_pos = m_binary_output.tellp();
-        const auto offset = write_pos - m_blob_offset;
         if (!m_enable_compression) {
+            const auto offset = align();
             m_binary_output.write(ptr, size);
             return offset;
         }
@@ -107,6 +109,7 @@ public:
             return found->second.first;
         }
 
+        const auto offset = align();
         m_binary_output.write(ptr, size);
         m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr)}});
 
@@ -114,9 +117,21 @@ public:
     }
 
 private:
+    // Pads the output with zeros up to the alignment and returns the offset of the next blob
+    FilePosition align() {
+        const FilePosition offset = static_cast<FilePosition>(m_binary_output.tellp()) - m_blob_offset;
+        const auto padding = (m_alignment - offset % m_alignment) % m_alignment;
+        if (padding != 0) {
+            const std::vector<char> zeros(padding, 0);
+            m_binary_output.write(zeros.data(), padding);
+        }
+        return offset + padding;
+    }
+
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
+    int64_t m_alignment;
     FilePosition m_blob_offset;  // blob offset inside output stream
 };
 
@@ -1141,11 +1156,16 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ngraph::Function>
     }
 
     // Blobs
+    // The blobs are aligned inside the stream, so they can be used in place when the stream is mapped to memory
+    const size_t custom_data_end = m_stream.tellp();
+    const size_t padding = (blobs_alignment - custom_data_end % blobs_alignment) % blobs_alignment;
+    const std::vector<char> zeros(padding, 0);
+    m_stream.write(zeros.data(), padding);
     hdr.consts_offset = m_stream.tellp();
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(m_stream);
+    ConstantWriter constant_write_handler(m_stream, true, blobs_alignment);
     XmlSerializer visitor(net_node, name, m_custom_opsets, constant_write_handler, version);
     std::shared_ptr<ov::Model> fun = f;
     visitor.on_attribute(name, fun);
@@ -1157,7 +1177,7 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ngraph::Function>
 
     const size_t file_size = m_stream.tellp();
 
-    hdr.custom_data_size = hdr.consts_offset - hdr.custom_data_offset;
+    hdr.custom_data_size = custom_data_end - hdr.custom_data_offset;
     hdr.consts_size = hdr.model_offset - hdr.consts_offset;
     hdr.model_size = file_size - hdr.model_offset;
 
@@ -1170,60 +1190,4 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ngraph::Function>
     return false;
 }
 
-/// -------- Hash calculation pass -------------
-
-namespace {
-template <typename T>
-static uint64_t hash_combine(uint64_t seed, const T& a) {
-    // Hash combine formula from boost
-    return seed ^ (std::hash<T>()(a) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
-}
-
-class OstreamHashWrapper final : public std::streambuf {
-    uint64_t m_res = 0;
-
-public:
-    uint64_t getResult() const {
-        return m_res;
-    }
-
-    std::streamsize xsputn(const char* s, std::streamsize n) override {
-        auto* intS = (const std::streamsize*)s;
-        std::streamsize n64 = n / static_cast<std::streamsize>(sizeof(std::streamsize));
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
-        }
-
-        std::streamsize rest = n % static_cast<std::streamsize>(sizeof(std::streamsize));
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
-        }
-        return n;
-    }
-};
-}  // namespace
-
-bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
-    RUN_ON_MODEL_SCOPE(Hash);
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
-
-    // Determinism is important for hash calculation
-    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true);
-
-    uint64_t seed = 0;
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
-
-    m_hash = seed;
-    // Return false because we didn't change nGraph Function
-    return false;
-}
-
-pass::Hash::Hash(uint64_t& output_hash_value) : m_hash(output_hash_value) {}
-
 }  // namespace ov
@@ -3522,3 +3522,92 @@ TEST(constant_folding, evaluate_on_tensor_vector) {
     ASSERT_EQ(data_shape, result_node->get_output_shape(0));
     ASSERT_EQ(add_expected, result_node->cast_vector<int>());
 }
+
+TEST(constant_folding, independent_subgraphs) {
+    // Enough independent dequantization sub-graphs to fold them concurrently
+    constexpr size_t subgraphs_count = 64;
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    NodeVector results;
+    for (size_t i = 0; i < subgraphs_count; ++i) {
+        const auto value = static_cast<int8_t>(i);
+        auto weights = make_shared<op::Constant>(element::i8, Shape{2, 2}, vector<int8_t>{value, 1, 2, 3});
+        auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+        auto shift = make_shared<op::v1::Subtract>(convert, op::Constant::create(element::f32, Shape{}, {1}));
+        auto scale = make_shared<op::v1::Multiply>(shift, op::Constant::create(element::f32, Shape{}, {2}));
+        scale->set_friendly_name("scale_" + std::to_string(i));
+        results.push_back(make_shared<op::v1::Add>(data, scale));
+    }
+    auto model = make_shared<Function>(results, ParameterVector{data});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(model);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Subtract>(model), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    EXPECT_EQ(count_ops_of_type<op::Constant>(model), subgraphs_count);
+    for (size_t i = 0; i < subgraphs_count; ++i) {
+        auto add = model->get_results().at(i)->get_input_node_shared_ptr(0);
+        auto folded = ov::as_type_ptr<op::Constant>(add->get_input_node_shared_ptr(1));
+        ASSERT_TRUE(folded);
+        ASSERT_EQ(folded->get_friendly_name(), "scale_" + std::to_string(i));
+        const auto value = static_cast<float>(static_cast<int8_t>(i));
+        vector<float> expected{(value - 1) * 2, 0, 2, 4};
+        ASSERT_EQ(folded->cast_vector<float>(), expected);
+    }
+}
+
+TEST(constant_folding, subgraph_with_shared_intermediate_node) {
+    auto weights = op::Constant::create(element::f32, Shape{2}, {1, 2});
+    auto convert = make_shared<op::v0::Convert>(weights, element::i32);
+    convert->set_friendly_name("convert");
+    auto negative = make_shared<op::v0::Negative>(convert);
+    negative->set_friendly_name("negative");
+    auto add = make_shared<op::v1::Add>(convert, negative);
+    add->set_friendly_name("add");
+    auto model = make_shared<Function>(NodeVector{convert, add}, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::Negative>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(model), 0);
+
+    auto folded_convert = ov::as_type_ptr<op::Constant>(model->get_results().at(0)->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(folded_convert);
+    ASSERT_EQ(folded_convert->get_friendly_name(), "convert");
+    ASSERT_EQ(folded_convert->cast_vector<int32_t>(), (vector<int32_t>{1, 2}));
+
+    auto folded_add = ov::as_type_ptr<op::Constant>(model->get_results().at(1)->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(folded_add);
+    ASSERT_EQ(folded_add->get_friendly_name(), "add");
+    ASSERT_EQ(folded_add->cast_vector<int32_t>(), (vector<int32_t>{0, 0}));
+}
+
+TEST(constant_folding, pass_reused_for_different_models) {
+    auto make_model = [](float value) {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{2});
+        auto weights = op::Constant::create(element::f32, Shape{2}, {value, value});
+        auto negative = make_shared<op::v0::Negative>(weights);
+        auto add = make_shared<op::v1::Add>(data, negative);
+        return make_shared<Function>(NodeVector{add}, ParameterVector{data});
+    };
+    auto first = make_model(1);
+    auto second = make_model(2);
+
+    pass::ConstantFolding constant_folding;
+    constant_folding.run_on_model(first);
+    constant_folding.run_on_model(second);
+
+    for (const auto& model : {first, second}) {
+        ASSERT_EQ(count_ops_of_type<op::v0::Negative>(model), 0);
+        ASSERT_EQ(count_ops_of_type<op::v1::Add>(model), 1);
+    }
+    auto add = second->get_results().at(0)->get_input_node_shared_ptr(0);
+    auto folded = ov::as_type_ptr<op::Constant>(add->get_input_node_shared_ptr(1));
+    ASSERT_TRUE(folded);
+    ASSERT_EQ(folded->cast_vector<float>(), (vector<float>{-2, -2}));
+}
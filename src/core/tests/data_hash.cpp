@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/data_hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace ov::util;
+
+TEST(data_hash, reference_values) {
+    EXPECT_EQ(0xEF46DB3751D8E999ULL, hash_data_chunk("", 0));
+    EXPECT_EQ(0xD24EC4F1A98C6E5BULL, hash_data_chunk("a", 1));
+    const char* str = "Nobody inspects the spammish repetition";
+    EXPECT_EQ(0xFBCEA83C8A378BF1ULL, hash_data_chunk(str, std::strlen(str)));
+}
+
+TEST(data_hash, small_data_is_single_chunk) {
+    const char* str = "Nobody inspects the spammish repetition";
+    EXPECT_EQ(hash_data_chunk(str, std::strlen(str)), hash_data(str, std::strlen(str)));
+}
+
+TEST(data_hash, chunked_equals_sequential) {
+    std::vector<uint8_t> data(data_hash_chunk_size * 3 + 17);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<uint8_t>(i * 7 + (i >> 8));
+    }
+
+    const size_t chunks_count = data_hash_chunks_count(data.size());
+    ASSERT_EQ(4, chunks_count);
+    std::vector<uint64_t> chunk_hashes(chunks_count);
+    // chunks can be hashed in any order
+    for (size_t i = chunks_count; i-- > 0;) {
+        const size_t offset = i * data_hash_chunk_size;
+        chunk_hashes[i] =
+            hash_data_chunk(data.data() + offset, std::min(data_hash_chunk_size, data.size() - offset), i);
+    }
+    EXPECT_EQ(hash_data(data.data(), data.size()),
+              combine_chunk_hashes(chunk_hashes.data(), chunks_count, data.size()));
+}
+
+TEST(data_hash, sensitive_to_data_change) {
+    std::vector<uint8_t> data(data_hash_chunk_size + 100, 0);
+    const auto ref = hash_data(data.data(), data.size());
+
+    data[data_hash_chunk_size + 50] = 1;
+    EXPECT_NE(ref, hash_data(data.data(), data.size()));
+    data[data_hash_chunk_size + 50] = 0;
+
+    // swapped words must not give the same hash
+    data[0] = 1;
+    const auto first = hash_data(data.data(), data.size());
+    data[0] = 0;
+    data[8] = 1;
+    EXPECT_NE(first, hash_data(data.data(), data.size()));
+
+    EXPECT_NE(ref, hash_data(data.data(), data.size() - 1));
+}
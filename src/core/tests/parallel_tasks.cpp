@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "parallel_tasks.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#if defined(__linux__)
+#    include <sys/wait.h>
+#    include <unistd.h>
+#endif
+
+using namespace ov;
+
+namespace {
+void check_all_tasks_run_once(size_t count) {
+    std::vector<std::atomic<size_t>> calls(count);
+    for (auto& c : calls) {
+        c = 0;
+    }
+    run_parallel_tasks(count, [&](size_t idx) {
+        calls[idx]++;
+    });
+    for (size_t idx = 0; idx < count; idx++) {
+        EXPECT_EQ(calls[idx], 1) << "task " << idx;
+    }
+}
+}  // namespace
+
+TEST(parallel_tasks, available_cpus_count) {
+    EXPECT_GE(get_available_cpus_count(), 1);
+}
+
+TEST(parallel_tasks, all_tasks_run_once) {
+    for (size_t count : {0, 1, 2, 7, 1000}) {
+        check_all_tasks_run_once(count);
+    }
+}
+
+TEST(parallel_tasks, cores_are_not_oversubscribed) {
+    std::atomic<size_t> active{0};
+    std::atomic<size_t> max_active{0};
+    run_parallel_tasks(256, [&](size_t) {
+        const size_t current = ++active;
+        size_t prev = max_active.load();
+        while (prev < current && !max_active.compare_exchange_weak(prev, current)) {
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        active--;
+    });
+    EXPECT_LE(max_active, get_available_cpus_count());
+}
+
+TEST(parallel_tasks, first_exception_is_rethrown_after_all_tasks) {
+    std::atomic<size_t> calls{0};
+    EXPECT_THROW(run_parallel_tasks(100,
+                                    [&](size_t idx) {
+                                        calls++;
+                                        if (idx % 10 == 3) {
+                                            throw std::runtime_error("task failed");
+                                        }
+                                    }),
+                 std::runtime_error);
+    EXPECT_EQ(calls, 100);
+    // the workers are released after the failure
+    check_all_tasks_run_once(100);
+}
+
+TEST(parallel_tasks, nested_calls) {
+    const size_t outer = 16, inner = 64;
+    std::vector<std::atomic<size_t>> calls(outer * inner);
+    for (auto& c : calls) {
+        c = 0;
+    }
+    run_parallel_tasks(outer, [&](size_t i) {
+        run_parallel_tasks(inner, [&](size_t j) {
+            calls[i * inner + j]++;
+        });
+    });
+    for (size_t idx = 0; idx < calls.size(); idx++) {
+        EXPECT_EQ(calls[idx], 1) << "task " << idx;
+    }
+}
+
+TEST(parallel_tasks, concurrent_callers) {
+    const size_t callers_count = 8, count = 500;
+    std::vector<std::vector<size_t>> calls(callers_count, std::vector<size_t>(count, 0));
+    std::vector<std::thread> callers;
+    for (size_t caller = 0; caller < callers_count; caller++) {
+        callers.emplace_back([&, caller]() {
+            for (size_t repeat = 0; repeat < 10; repeat++) {
+                // each task index is written by a single thread
+                run_parallel_tasks(count, [&](size_t idx) {
+                    calls[caller][idx]++;
+                });
+            }
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    for (const auto& caller_calls : calls) {
+        EXPECT_TRUE(std::all_of(caller_calls.begin(), caller_calls.end(), [](size_t c) {
+            return c == 10;
+        }));
+    }
+}
+
+#if defined(__linux__)
+TEST(parallel_tasks, run_in_forked_process) {
+    check_all_tasks_run_once(100);
+
+    std::atomic<bool> stop{false};
+    // the fork happens while the workers of another thread are busy
+    std::thread busy([&]() {
+        while (!stop) {
+            run_parallel_tasks(64, [](size_t) {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            });
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    const pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        std::atomic<size_t> calls{0};
+        run_parallel_tasks(1000, [&](size_t) {
+            calls++;
+        });
+        _exit(calls == 1000 ? 0 : 1);
+    }
+    stop = true;
+    busy.join();
+
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+#endif
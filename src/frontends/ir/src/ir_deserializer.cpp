@@ -7,6 +7,7 @@
 #include <pugixml.hpp>
 
 #include "ie_ngraph_utils.hpp"
+#include "ie_parallel.hpp"
 #include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "rt_info_deserializer.hpp"
@@ -16,6 +17,39 @@
 
 using namespace ov;
 
+namespace {
+// Symmetric function to translate type name.
+// See translate_type_name in src/core/src/pass/serialize.cpp.
+const std::string& translate_type_name(const std::string& name) {
+    static const std::unordered_map<std::string, std::string> translate_type_name_translator = {{"Const", "Constant"},
+                                                                                                {"PReLU", "PRelu"},
+                                                                                                {"ReLU", "Relu"},
+                                                                                                {"SoftMax", "Softmax"}};
+    auto found = translate_type_name_translator.find(name);
+    if (found != end(translate_type_name_translator)) {
+        return found->second;
+    }
+    return name;
+}
+
+// Runs func for every index in parallel, the first exception in the index order is rethrown
+template <typename F>
+void parallel_for_rethrow(size_t size, const F& func) {
+    std::vector<std::exception_ptr> errors(size);
+    InferenceEngine::parallel_for(size, [&](size_t i) {
+        try {
+            func(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+}  // namespace
+
 XmlDeserializer::IoMap XmlDeserializer::updated_io_map(const pugi::xml_node& node, const pugi::xml_node& body_node) {
     if (body_node.empty()) {
         IE_THROW() << "Missing body part.";
@@ -427,9 +461,16 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<edge>> edges;
+    // Generic parameters of the layers are independent, so they are parsed in parallel
+    std::vector<node_params> layers;
+    FOREACH_CHILD (node, root.child("layers"), "layer") { layers.push_back({node, {}}); }
+    parallel_for_rethrow(layers.size(), [&](size_t i) {
+        layers[i].params = parseGenericParams(layers[i].xml);
+    });
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+    for (const auto& layer : layers) {
+        const auto& node = layer.xml;
+        const auto& node_param = layer.params;
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
@@ -473,6 +514,27 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
+    // Constants and Parameters don't depend on other layers and the graph state, so they are created in parallel.
+    // The layers created by extensions are left for the sequential pass as extensions may be not thread safe.
+    std::vector<size_t> independent_layers;
+    for (const auto& layer_id : order) {
+        const auto& p = params[layer_id].params;
+        const auto& type_name = translate_type_name(p.type);
+        if ((type_name == "Constant" || type_name == "Parameter") && p.inputPorts.empty() &&
+            !m_extensions.count(ov::DiscreteTypeInfo(type_name.c_str(), 0, p.version.c_str()))) {
+            independent_layers.push_back(layer_id);
+        }
+    }
+    std::vector<std::shared_ptr<ngraph::Node>> independent_nodes(independent_layers.size());
+    parallel_for_rethrow(independent_layers.size(), [&](size_t i) {
+        const auto& p = params.at(independent_layers[i]);
+        independent_nodes[i] = createNode({}, p.xml, weights, p.params);
+    });
+    std::map<size_t, std::shared_ptr<ngraph::Node>> created_nodes;
+    for (size_t i = 0; i < independent_layers.size(); i++) {
+        created_nodes[independent_layers[i]] = std::move(independent_nodes[i]);
+    }
+
     //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
@@ -493,7 +555,9 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             inputs[realInputPortId] = input_node->output(p_output.getRealOutputPortId(e.fromPortId));
         }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
+        const auto created_node = created_nodes.find(layer_id);
+        auto node = created_node != created_nodes.end() ? created_node->second
+                                                        : createNode(inputs, p.xml, weights, p.params);
         id_to_node[layer_id] = node;
 
         // Check that output shape after OpenVINO node validation the same as in IR
@@ -608,20 +672,6 @@ GenericLayerParams XmlDeserializer::parseGenericParams(const pugi::xml_node& nod
     return params;
 }
 
-// Symmetric function to translate type name.
-// See translate_type_name in src/core/src/pass/serialize.cpp.
-static const std::string& translate_type_name(const std::string& name) {
-    static const std::unordered_map<std::string, std::string> translate_type_name_translator = {{"Const", "Constant"},
-                                                                                                {"PReLU", "PRelu"},
-                                                                                                {"ReLU", "Relu"},
-                                                                                                {"SoftMax", "Softmax"}};
-    auto found = translate_type_name_translator.find(name);
-    if (found != end(translate_type_name_translator)) {
-        return found->second;
-    }
-    return name;
-}
-
 std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
     const std::vector<ngraph::Output<ngraph::Node>>& inputs,
     const pugi::xml_node& node,
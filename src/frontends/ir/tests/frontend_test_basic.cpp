@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+#include <sstream>
+
 #include "frontend_test.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset3.hpp"
@@ -342,6 +345,88 @@ TEST_F(IRFrontendTests, model_with_weights_reading_from_disk) {
     EXPECT_TRUE(res.valid) << res.message;
 }
 
+TEST_F(IRFrontendTests, model_with_weights_reading_from_disk_without_mmap) {
+    std::string xmlModel = R"V0G0N(
+<?xml version="1.0" ?>
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="value1" type="Const" version="opset1">
+            <data element_type="f32" shape="4" offset="0" size="16" />
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="Add" type="Add" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+                <port id="1" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="3" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    const std::vector<float> values{1.f, 2.f, 3.f, 4.f};
+    std::vector<unsigned char> buffer(values.size() * sizeof(float));
+    std::memcpy(buffer.data(), values.data(), buffer.size());
+
+    createTemporalModelFile(xmlModel, buffer);
+
+    auto FE = manager.load_by_framework("ir");
+    ASSERT_TRUE(!!FE);
+
+    // the same model is read with the weights mapped to memory (default) and read to a buffer
+    for (const auto& params : {ov::AnyVector{xmlFileName, binFileName},
+                               ov::AnyVector{xmlFileName, binFileName, true},
+                               ov::AnyVector{xmlFileName, binFileName, false}}) {
+        std::shared_ptr<ov::Model> model;
+        ov::frontend::InputModel::Ptr inputModel;
+        ASSERT_NO_THROW(inputModel = FE->load(params));
+        ASSERT_TRUE(!!inputModel);
+        ASSERT_NO_THROW(model = FE->convert(inputModel));
+        ASSERT_TRUE(!!model);
+
+        std::shared_ptr<ov::opset1::Constant> constant;
+        for (const auto& op : model->get_ordered_ops()) {
+            if (auto c = std::dynamic_pointer_cast<ov::opset1::Constant>(op))
+                constant = c;
+        }
+        ASSERT_TRUE(!!constant);
+        EXPECT_EQ(constant->cast_vector<float>(), values);
+    }
+}
+
 TEST_F(IRFrontendTests, model_without_weights_reading_from_disk) {
     std::string xmlModel = R"V0G0N(
 <?xml version="1.0" ?>
@@ -957,3 +1042,114 @@ TEST_F(IRFrontendTests, wrong_opset) {
     ASSERT_THROW(model = core.read_model(testModel, ov::Tensor()), ov::Exception);
     ASSERT_FALSE(!!model);
 }
+
+TEST_F(IRFrontendTests, model_with_many_constants_reading_from_disk) {
+    // Constants are created in parallel, so the graph has to be the same as the serially created one
+    const size_t layersCount = 256;
+    std::stringstream layers, edges;
+    layers << R"V0G0N(
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+    for (size_t i = 0; i < layersCount; i++) {
+        const size_t constId = 1 + 2 * i;
+        const size_t addId = 2 + 2 * i;
+        layers << R"V0G0N(
+        <layer id=")V0G0N" << constId << R"V0G0N(" name="value)V0G0N" << i << R"V0G0N(" type="Const" version="opset1">
+            <data element_type="f32" shape="1" offset=")V0G0N" << i * sizeof(float) << R"V0G0N(" size="4" />
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id=")V0G0N" << addId << R"V0G0N(" name="add)V0G0N" << i << R"V0G0N(" type="Add" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                </port>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+        edges << R"V0G0N(
+        <edge from-layer=")V0G0N" << (i == 0 ? 0 : addId - 2) << R"V0G0N(" from-port=")V0G0N" << (i == 0 ? 0 : 2)
+              << R"V0G0N(" to-layer=")V0G0N" << addId << R"V0G0N(" to-port="0"/>
+        <edge from-layer=")V0G0N" << constId << R"V0G0N(" from-port="0" to-layer=")V0G0N" << addId
+              << R"V0G0N(" to-port="1"/>)V0G0N";
+    }
+    const size_t resultId = 2 * layersCount + 1;
+    layers << R"V0G0N(
+        <layer name="output" type="Result" id=")V0G0N" << resultId << R"V0G0N(" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                </port>
+            </input>
+        </layer>)V0G0N";
+    edges << R"V0G0N(
+        <edge from-layer=")V0G0N" << resultId - 1 << R"V0G0N(" from-port="2" to-layer=")V0G0N" << resultId
+          << R"V0G0N(" to-port="0"/>)V0G0N";
+
+    std::stringstream xmlModel;
+    xmlModel << R"V0G0N(<?xml version="1.0" ?>
+<net name="Network" version="11">
+    <layers>)V0G0N"
+             << layers.str() << R"V0G0N(
+    </layers>
+    <edges>)V0G0N"
+             << edges.str() << R"V0G0N(
+    </edges>
+</net>
+)V0G0N";
+
+    std::vector<float> values(layersCount);
+    for (size_t i = 0; i < layersCount; i++) {
+        values[i] = static_cast<float>(i);
+    }
+    std::vector<unsigned char> buffer(layersCount * sizeof(float));
+    std::memcpy(buffer.data(), values.data(), buffer.size());
+
+    createTemporalModelFile(xmlModel.str(), buffer);
+
+    std::shared_ptr<ov::Model> model;
+
+    ASSERT_NO_THROW(model = core.read_model(xmlFileName, binFileName));
+    ASSERT_TRUE(!!model);
+
+    std::shared_ptr<ov::Model> modelRef;
+    {
+        auto parameter = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1});
+        parameter->set_friendly_name("input");
+        ov::Output<ov::Node> last = parameter;
+        for (size_t i = 0; i < layersCount; i++) {
+            auto constant = std::make_shared<ov::opset1::Constant>(ov::element::f32, ov::Shape{1}, std::vector<float>{values[i]});
+            constant->set_friendly_name("value" + std::to_string(i));
+            auto add = std::make_shared<ov::opset1::Add>(last, constant);
+            add->set_friendly_name("add" + std::to_string(i));
+            last = add;
+        }
+        auto result = std::make_shared<ov::opset1::Result>(last);
+        result->set_friendly_name("output");
+        modelRef = std::make_shared<ov::Model>(ov::NodeVector{result}, ov::ParameterVector{parameter});
+    }
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(model, modelRef);
+    EXPECT_TRUE(res.valid) << res.message;
+}
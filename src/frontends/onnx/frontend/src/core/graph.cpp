@@ -146,11 +146,13 @@ Graph::Graph(const std::string& model_dir,
     transform::expand_onnx_functions(*model_proto);
 
     std::map<std::string, Tensor> initializers;
+    // Constants share the initializers data with the model proto and the mapped external data files
+    const auto mmap_cache = std::make_shared<std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>>();
 
     // Process all initializers in the graph
     for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor, m_model_dir};
+            Tensor tensor = Tensor{initializer_tensor, m_model_dir, model_proto, mmap_cache};
             std::shared_ptr<default_opset::Constant> ng_constant;
             // For each initializer create a Constant node and store it in cache
             try {
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
@@ -105,10 +106,23 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const std::string& model_dir)
+    /// \brief      Creates the tensor
+    ///
+    /// \param      tensor       Tensor description
+    /// \param      model_dir    Directory of the model, external data paths are relative to it
+    /// \param      model_proto  Model owning the tensor description. If passed, the constant shares the data
+    ///                          of the model instead of copying it.
+    /// \param      mmap_cache   External data files mapped for the model. If passed, the constant shares the
+    ///                          mapped external data instead of reading it.
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const std::string& model_dir,
+                    std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto = nullptr,
+                    detail::MappedMemoryHandles mmap_cache = nullptr)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
-          m_model_dir{model_dir} {
+          m_model_dir{model_dir},
+          m_model_proto{std::move(model_proto)},
+          m_mmap_cache{std::move(mmap_cache)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -234,13 +248,11 @@ private:
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
-        int data_size = get_data_size();
         if (has_external_data()) {
-            auto external_data = load_external_data();
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-        } else if (data_size == shape_size(m_shape)) {
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
-        } else if (data_size == 0 && m_shape.size() == 0) {
+            constant = make_external_data_constant(type);
+        } else if (get_data_size() == shape_size(m_shape)) {
+            constant = make_shared_data_constant(type, get_data_ptr());
+        } else if (get_data_size() == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
         } else {
             throw error::tensor::shape_doesnt_match_data_size{};
@@ -252,12 +264,30 @@ private:
         return constant;
     }
 
+    // The types below are stored in the wider typed fields, so only raw and external data may be shared
     template <typename T,
               typename std::enable_if<!std::is_same<T, float>::value && !std::is_same<T, double>::value &&
                                           !std::is_same<T, int32_t>::value && !std::is_same<T, int64_t>::value &&
                                           !std::is_same<T, uint64_t>::value,
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
+        std::shared_ptr<default_opset::Constant> constant{nullptr};
+        if (has_external_data()) {
+            constant = make_external_data_constant(type);
+        } else if (m_tensor_proto->has_raw_data() && get_data_size() == shape_size(m_shape)) {
+            constant = make_shared_data_constant(type, m_tensor_proto->raw_data().data());
+        } else {
+            return make_ng_constant_from_vector<T>(type);
+        }
+
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
+    template <typename T>
+    std::shared_ptr<ngraph::op::Constant> make_ng_constant_from_vector(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         auto data = get_data<T>();
         auto data_size = data.size();
@@ -268,6 +298,7 @@ private:
         } else {
             throw error::tensor::shape_doesnt_match_data_size{};
         }
+
         if (m_tensor_proto->has_name()) {
             constant->set_friendly_name(get_name());
         }
@@ -290,6 +321,36 @@ private:
         return detail::__get_raw_data<T>(load_external_data(), m_tensor_proto->data_type());
     }
 
+    std::shared_ptr<ngraph::op::Constant> make_external_data_constant(const element::Type& type) const {
+        const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+        const auto data_size_in_bytes = shape_size(m_shape) * type.size();
+        if (m_mmap_cache) {
+            auto mapped_data = tensor_external_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
+            if (mapped_data->size() < data_size_in_bytes) {
+                throw error::tensor::shape_doesnt_match_data_size{};
+            }
+            return std::make_shared<ngraph::op::Constant>(type, m_shape, mapped_data);
+        }
+        const auto external_data = tensor_external_data.load_external_data(m_model_dir);
+        if (external_data.size() < data_size_in_bytes) {
+            throw error::tensor::shape_doesnt_match_data_size{};
+        }
+        return std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
+    }
+
+    // The constant refers to the data of the model instead of copying it when the model is known
+    std::shared_ptr<ngraph::op::Constant> make_shared_data_constant(const element::Type& type, const void* data) const {
+        const auto data_size_in_bytes = shape_size(m_shape) * type.size();
+        if (!m_model_proto || data_size_in_bytes == 0) {
+            return std::make_shared<ngraph::op::Constant>(type, m_shape, data);
+        }
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ONNX_NAMESPACE::ModelProto>>>(
+            static_cast<char*>(const_cast<void*>(data)),
+            data_size_in_bytes,
+            m_model_proto);
+        return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+    }
+
     const void* get_data_ptr() const {
         if (m_tensor_proto->has_raw_data()) {
             return m_tensor_proto->raw_data().data();
@@ -331,6 +392,8 @@ private:
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
     std::string m_model_dir;
+    std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
@@ -230,6 +230,15 @@ struct onnx_editor::ONNXModelEditor::Impl {
         : m_model_proto{
               std::make_shared<ONNX_NAMESPACE::ModelProto>(ngraph::onnx_common::parse_from_file(model_path))} {}
 #endif
+
+    // Constants of the converted models refer to the initializers of the model proto,
+    // so the proto is copied before the initializers are modified or removed
+    void detach_model_proto() {
+        if (m_model_proto.use_count() > 1) {
+            m_model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>(*m_model_proto);
+            m_is_mapper_updated = false;
+        }
+    }
 };
 
 onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::string& model_path, frontend::ExtensionHolder extensions)
@@ -367,6 +376,8 @@ PartialShape onnx_editor::ONNXModelEditor::get_tensor_shape(const std::string& t
 void onnx_editor::ONNXModelEditor::extract_subgraph(const std::vector<InputEdge>& inputs,
                                                     const std::vector<OutputEdge>& outputs,
                                                     const bool merge_inputs) {
+    // the extraction removes the initializers of the cut off nodes and the ones replaced with the new inputs
+    m_pimpl->detach_model_proto();
     if (inputs.empty() && outputs.empty()) {
         return;
     }
@@ -449,6 +460,7 @@ std::shared_ptr<Model> onnx_editor::ONNXModelEditor::get_function() const {
 
 void onnx_editor::ONNXModelEditor::set_input_values(
     const std::map<std::string, std::shared_ptr<ngraph::op::Constant>>& input_values) {
+    m_pimpl->detach_model_proto();
     auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input : input_values) {
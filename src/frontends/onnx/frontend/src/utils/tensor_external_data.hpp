@@ -6,9 +6,19 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief  Memory mapped external data files shared by the initializers of a model, the key is a full file path
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +33,19 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data(const std::string& model_dir) const;
 
+    /// \brief      Map external data from tensor passed to constructor to memory
+    ///
+    /// \note       If mapping of the external file fails,
+    ///             the invalid_external_data exception is thrown.
+    ///
+    /// \param      model_dir  Directory of the model the external data paths are relative to
+    /// \param      cache      Already mapped files, each file is mapped once for the whole model
+    ///
+    /// \return     Buffer which points to the mapped external data and keeps the file mapped
+    std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>> load_external_mmap_data(
+        const std::string& model_dir,
+        MappedMemoryHandles cache) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
@@ -455,6 +455,26 @@ NGRAPH_TEST(onnx_editor, subgraph__initializer_to_input_replacement_2) {
     EXPECT_TRUE(result.is_ok) << result.error_message;
 }
 
+NGRAPH_TEST(onnx_editor, subgraph__initializer_to_input_replacement_after_conversion) {
+    ONNXModelEditor editor{ngraph::file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                                                        SERIALIZED_ZOO,
+                                                        "onnx/model_editor/add_1D_with_initializers.onnx")};
+    // the constants of the converted model share the initializers data with the editor
+    const auto original_function = editor.get_function();
+
+    // the cut through the input of the Add node removes the "B" initializer
+    editor.extract_subgraph({{InputEdge{0, 1}}}, {});
+
+    auto modified_test_case = ngraph::test::TestCase(editor.get_function());
+    modified_test_case.add_input<int64_t>(Shape{2}, {3, 4});
+    modified_test_case.add_expected_output<int64_t>(Shape{2}, {4, 6});
+    modified_test_case.run();
+
+    auto original_test_case = ngraph::test::TestCase(original_function);
+    original_test_case.add_expected_output<int64_t>(Shape{2}, {2, 4});
+    original_test_case.run();
+}
+
 NGRAPH_TEST(onnx_editor, subgraph__multiout_op_output_edge) {
     ONNXModelEditor editor{ngraph::file_util::path_join(CommonTestUtils::getExecutableDirectory(),
                                                         SERIALIZED_ZOO,
@@ -1394,6 +1414,27 @@ NGRAPH_TEST(onnx_editor, values__modify_one_initializer) {
     test_case.run();
 }
 
+NGRAPH_TEST(onnx_editor, values__modify_initializer_after_conversion) {
+    onnx_editor::ONNXModelEditor editor{
+        ngraph::file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                                     SERIALIZED_ZOO,
+                                     "onnx/model_editor/add_1D_with_initializers.onnx")};
+    // the constants of the converted model share the initializers data with the editor
+    const auto original_function = editor.get_function();
+
+    std::map<std::string, std::shared_ptr<ngraph::op::Constant>> in_vals;
+    in_vals.emplace("B", ngraph::op::Constant::create(element::i64, Shape{2}, {3, 4}));
+    editor.set_input_values(in_vals);
+
+    auto modified_test_case = ngraph::test::TestCase(editor.get_function());
+    modified_test_case.add_expected_output<int64_t>(Shape{2}, {4, 6});
+    modified_test_case.run();
+
+    auto original_test_case = ngraph::test::TestCase(original_function);
+    original_test_case.add_expected_output<int64_t>(Shape{2}, {2, 4});
+    original_test_case.run();
+}
+
 NGRAPH_TEST(onnx_editor, values__modify_two_initializers) {
     onnx_editor::ONNXModelEditor editor{
         ngraph::file_util::path_join(CommonTestUtils::getExecutableDirectory(),
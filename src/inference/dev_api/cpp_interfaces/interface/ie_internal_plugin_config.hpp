@@ -46,6 +46,20 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Makes CPU Executor Streams use a concurrent task queue instead of the single mutex protected one, so the
+ * producers and the streams don't contend on the same lock (YES/NO, NO by default). Requires TBB threading.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_LOCK_FREE_QUEUE);
+
+/**
+ * @brief Number of the task queue polls an idle CPU Executor Streams thread does before falling asleep,
+ * only used together with the CPU_STREAMS_LOCK_FREE_QUEUE (0 by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_WAIT_SPIN_COUNT);
+
 /**
  * @brief Defines how many records can be stored in the CPU runtime parameters cache per CPU runtime parameter type per
  * stream
@@ -53,6 +67,29 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Enables a single thread safe CPU runtime parameters cache shared by all the streams of an executable network,
+ * so the primitives prepared by one stream are reused by the others (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_SHARED);
+
+/**
+ * @brief Enables concurrent execution of the independent nodes of a static CPU graph (YES/NO, NO by default).
+ * The nodes are grouped into dependency levels, the nodes of the same level are dispatched to the threading runtime
+ * concurrently. Takes effect only with the TBB threading runtime.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_GRAPH_EXECUTION);
+
+/**
+ * @brief Defines the size in bytes of the process wide cache of the constant subgraphs results (weights reorders,
+ * decompression etc) reused by the next compilations of the same weights. The least recently used results are
+ * evicted when the size is exceeded. Zero (the default) disables the cache.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_CONSTANTS_CACHE_CAPACITY);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
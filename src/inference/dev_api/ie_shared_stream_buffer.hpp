@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the stream buffer over a shared memory region
+ *
+ * @file ie_shared_stream_buffer.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <streambuf>
+
+#include "ie_api.h"
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Read-only stream buffer over a memory region which is owned by the buffer
+ * @ingroup ie_dev_api_memory
+ *
+ * Used by the cache manager to pass a memory mapped cache entry to plugins: a plugin may get the buffer back
+ * with `dynamic_cast<SharedStreamBuffer*>(stream.rdbuf())` and share the stream content instead of copying it.
+ */
+class INFERENCE_ENGINE_API_CLASS(SharedStreamBuffer) : public std::streambuf {
+public:
+    /**
+     * @brief Creates the stream buffer over the whole memory region
+     * @param buffer Memory region to read
+     */
+    explicit SharedStreamBuffer(std::shared_ptr<ngraph::runtime::AlignedBuffer> buffer);
+
+    /**
+     * @brief Destructor
+     */
+    ~SharedStreamBuffer() override;
+
+    /**
+     * @brief Returns the memory region the stream buffer reads
+     * @return Shared pointer to the memory region
+     */
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& getBuffer() const noexcept {
+        return m_buffer;
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+
+private:
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> m_buffer;
+};
+
+}  // namespace InferenceEngine
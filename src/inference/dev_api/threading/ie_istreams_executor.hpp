@@ -103,6 +103,8 @@ public:
                          // (for large #streams)
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        bool _lockFreeTaskQueue = false;  //!< Use the concurrent task queue instead of the mutex protected one
+        int _waitSpinCount = 0;           //!< Number of the task queue polls before an idle stream thread falls asleep
 
         /**
          * @brief      A constructor with arguments
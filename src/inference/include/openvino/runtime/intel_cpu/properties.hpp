@@ -47,5 +47,82 @@ namespace intel_cpu {
  */
 static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATION"};
 
+/**
+ * @brief Read-only property to get the hit/miss/eviction counters of the CPU runtime parameters cache of a compiled model.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The counters are accumulated over all the streams of the compiled model. The map contains the "HITS", "MISSES" and
+ * "EVICTIONS" keys, and the same counters of the dynamic shape inference cache with the "SHAPE_INFER_" prefix.
+ *
+ * @code
+ * auto stat = compiled_model.get_property(ov::intel_cpu::runtime_cache_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the usage of the process wide constants cache by a compiled model.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The map contains the "HITS" key with the number of the constant nodes which outputs were taken from the cache
+ * during the compilation (summed over all the streams), and the "SIZE" key with the size of the data currently
+ * stored in the cache by all the compiled models in bytes. The hits are 0 if the cache is disabled.
+ *
+ * @code
+ * auto stat = compiled_model.get_property(ov::intel_cpu::constants_cache_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> constants_cache_statistics{
+    "CPU_CONSTANTS_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the placement of the weights of a compiled model on the NUMA nodes.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The streams of each NUMA node share a weights replica bound to the memory of that node. For every NUMA node the map
+ * contains the "NODE_<id>_TOTAL" key with the size of the replica in bytes and the "NODE_<id>_LOCAL" key with the size
+ * of the replica part actually located at the node. The local size is 0 if the system doesn't report the placement.
+ *
+ * @code
+ * auto placement = compiled_model.get_property(ov::intel_cpu::weights_numa_placement);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> weights_numa_placement{
+    "CPU_WEIGHTS_NUMA_PLACEMENT"};
+
+/**
+ * @brief Read-only property to get the counters of the inference inputs and outputs passed with and without a copy.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The tensors of the compatible precision and layout are bound to the graph memory directly, the dynamic shape ones
+ * as well while the data fits into the tensor. The counters are accumulated over all the infer requests of the
+ * compiled model. The map contains the "ZERO_COPY" key with the number of the bound tensors and the number of the
+ * copies by the reason: "PRECISION", "LAYOUT", "PREPROCESSING", "DYNAMIC_BATCH", "IN_PLACE" (the graph memory can't
+ * be replaced) and "CAPACITY" (the output doesn't fit into the tensor).
+ *
+ * @code
+ * auto stat = compiled_model.get_property(ov::intel_cpu::io_copy_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> io_copy_statistics{
+    "CPU_IO_COPY_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the operations executed by the reference implementations of OpenVINO core.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The operations without a CPU plugin implementation fall back to the single-threaded reference evaluation. For every
+ * such operation the map contains the "<type>:<name>:COUNT" key with the number of the executions and the
+ * "<type>:<name>:TIME_US" key with the accumulated execution time in microseconds, both summed over all the streams.
+ * The map is empty if every operation of the model has a plugin implementation.
+ *
+ * @code
+ * auto stat = compiled_model.get_property(ov::intel_cpu::reference_fallback_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> reference_fallback_statistics{
+    "CPU_REFERENCE_FALLBACK_STATISTICS"};
+
 }  // namespace intel_cpu
 }  // namespace ov
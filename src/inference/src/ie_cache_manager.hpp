@@ -16,6 +16,9 @@
 
 #include "file_utils.h"
 #include "ie_api.h"
+#include "ie_shared_stream_buffer.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace InferenceEngine {
 
@@ -75,11 +78,13 @@ public:
 /**
  * @brief File storage-based Implementation of ICacheManager
  *
- * Uses simple file for read/write cached models.
+ * Uses simple file for read/write cached models. Cache entries are mapped to memory on read, so plugins
+ * which recognize SharedStreamBuffer can use the entry content in place instead of copying it.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
     std::string m_cachePath;
+    bool m_enableMmap;
 
     std::string getBlobFile(const std::string& blobHash) const {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
@@ -88,9 +93,12 @@ class FileStorageCacheManager final : public ICacheManager {
 public:
     /**
      * @brief Constructor
-     *
+     * @param cachePath Directory to keep the cache entries in
+     * @param enableMmap Whether to map the cache entries to memory on read
      */
-    FileStorageCacheManager(std::string cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string cachePath, bool enableMmap = true)
+        : m_cachePath(std::move(cachePath)),
+          m_enableMmap(enableMmap) {}
 
     /**
      * @brief Destructor
@@ -100,16 +108,40 @@ public:
 
 private:
     void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
+        auto blobFileName = getBlobFile(id);
+        // The old entry may still be mapped by a compiled model, so it is unlinked instead of being truncated
+        if (FileUtils::fileExist(blobFileName))
+            std::remove(blobFileName.c_str());
+        std::ofstream stream(blobFileName, std::ios_base::binary | std::ofstream::out);
         writer(stream);
     }
 
     void readCacheEntry(const std::string& id, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
+        if (!FileUtils::fileExist(blobFileName))
+            return;
+
+        if (m_enableMmap) {
+            std::shared_ptr<ov::util::MappedMemory> mapped;
+            try {
+                mapped = ov::util::load_mmap_object(blobFileName);
+            } catch (const std::runtime_error&) {
+                // fall back to the regular file reading
+            }
+            if (mapped && mapped->data()) {
+                auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+                    mapped->data(),
+                    mapped->size(),
+                    mapped);
+                SharedStreamBuffer streamBuffer(std::move(buffer));
+                std::istream stream(&streamBuffer);
+                reader(stream);
+                return;
+            }
         }
+
+        std::ifstream stream(blobFileName, std::ios_base::binary);
+        reader(stream);
     }
 
     void removeCacheEntry(const std::string& id) override {
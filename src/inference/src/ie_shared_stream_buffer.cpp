@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_shared_stream_buffer.hpp"
+
+namespace InferenceEngine {
+
+SharedStreamBuffer::SharedStreamBuffer(std::shared_ptr<ngraph::runtime::AlignedBuffer> buffer)
+    : m_buffer(std::move(buffer)) {
+    auto begin = m_buffer ? m_buffer->get_ptr<char>() : nullptr;
+    auto size = m_buffer ? m_buffer->size() : 0;
+    setg(begin, begin, begin + size);
+}
+
+SharedStreamBuffer::~SharedStreamBuffer() = default;
+
+SharedStreamBuffer::pos_type SharedStreamBuffer::seekoff(off_type off,
+                                                         std::ios_base::seekdir dir,
+                                                         std::ios_base::openmode which) {
+    if (!(which & std::ios_base::in))
+        return pos_type(off_type(-1));
+
+    off_type base = 0;
+    if (dir == std::ios_base::cur) {
+        base = gptr() - eback();
+    } else if (dir == std::ios_base::end) {
+        base = egptr() - eback();
+    }
+    const off_type pos = base + off;
+    if (pos < 0 || pos > egptr() - eback())
+        return pos_type(off_type(-1));
+
+    setg(eback(), eback() + pos, egptr());
+    return pos_type(pos);
+}
+
+SharedStreamBuffer::pos_type SharedStreamBuffer::seekpos(pos_type pos, std::ios_base::openmode which) {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+}  // namespace InferenceEngine
@@ -23,6 +23,10 @@
 #include "threading/ie_thread_affinity.hpp"
 #include "threading/ie_thread_local.hpp"
 
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+#    include <tbb/concurrent_queue.h>
+#endif
+
 using namespace openvino;
 
 namespace InferenceEngine {
@@ -220,6 +224,14 @@ struct CPUStreamsExecutor::Impl {
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+                if (_config._lockFreeTaskQueue) {
+                    for (Task task; WaitConcurrentTask(task); task = nullptr) {
+                        Execute(task, *(_streams.local()));
+                    }
+                    return;
+                }
+#endif
                 for (bool stopped = false; !stopped;) {
                     Task task;
                     {
@@ -240,7 +252,41 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    // Returns false only if the executor is stopped and all the tasks are done
+    bool WaitConcurrentTask(Task& task) {
+        for (int i = 0; i < _config._waitSpinCount && !_isStopped; ++i) {
+            if (_concurrentTaskQueue.try_pop(task)) {
+                return true;
+            }
+            std::this_thread::yield();
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        _sleepingThreads.fetch_add(1);
+        // pairs with the fence in Enqueue: either the producer sees the sleeping thread or the thread sees the task
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool popped = false;
+        _queueCondVar.wait(lock, [&] {
+            return (popped = _concurrentTaskQueue.try_pop(task)) || _isStopped;
+        });
+        _sleepingThreads.fetch_sub(1);
+        return popped || _concurrentTaskQueue.try_pop(task);
+    }
+#endif
+
     void Enqueue(Task task) {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+        if (_config._lockFreeTaskQueue) {
+            _concurrentTaskQueue.push(std::move(task));
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (_sleepingThreads.load() > 0) {
+                // the sleeping thread either waits on the condition variable already or is going to check the queue
+                { std::lock_guard<std::mutex> lock(_mutex); }
+                _queueCondVar.notify_one();
+            }
+            return;
+        }
+#endif
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -285,7 +331,11 @@ struct CPUStreamsExecutor::Impl {
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    std::atomic<bool> _isStopped{false};
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    tbb::concurrent_queue<Task> _concurrentTaskQueue;
+    std::atomic<int> _sleepingThreads{0};
+#endif
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -27,6 +27,8 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() const {
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_STREAMS_LOCK_FREE_QUEUE),
+        CONFIG_KEY_INTERNAL(CPU_STREAMS_WAIT_SPIN_COUNT),
         ov::num_streams.name(),
         ov::inference_num_threads.name(),
         ov::affinity.name(),
@@ -150,6 +152,28 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                        << ". Expected only non negative numbers (#threads)";
         }
         _threadsPerStream = val_i;
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_LOCK_FREE_QUEUE)) {
+        if (value == CONFIG_VALUE(YES)) {
+            _lockFreeTaskQueue = true;
+        } else if (value == CONFIG_VALUE(NO)) {
+            _lockFreeTaskQueue = false;
+        } else {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAMS_LOCK_FREE_QUEUE)
+                       << ". Expected only YES/NO";
+        }
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_WAIT_SPIN_COUNT)) {
+        int val_i;
+        try {
+            val_i = std::stoi(value);
+        } catch (const std::exception&) {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAMS_WAIT_SPIN_COUNT)
+                       << ". Expected only non negative numbers";
+        }
+        if (val_i < 0) {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAMS_WAIT_SPIN_COUNT)
+                       << ". Expected only non negative numbers";
+        }
+        _waitSpinCount = val_i;
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -188,6 +212,10 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) const {
         return decltype(ov::inference_num_threads)::value_type{_threads};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {std::to_string(_threadsPerStream)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_LOCK_FREE_QUEUE)) {
+        return {_lockFreeTaskQueue ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_WAIT_SPIN_COUNT)) {
+        return {std::to_string(_waitSpinCount)};
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
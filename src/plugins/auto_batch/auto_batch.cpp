@@ -196,6 +196,7 @@ void AutoBatchInferRequest::ShareBlobsWithBatchRequest(const std::set<std::strin
             IE_THROW() << "Unsupported input precision " << it.second->getTensorDesc().getPrecision();
         }
         _inputs[it.first] = res;
+        _batchedInputsViews[it.first] = res;
     }
     // Allocate all output blobs
     for (const auto& it : _networkOutputs) {
@@ -310,6 +311,7 @@ void AutoBatchInferRequest::ShareBlobsWithBatchRequest(const std::set<std::strin
             IE_THROW(NotImplemented) << "Unsupported input precision " << it.second->getTensorDesc().getPrecision();
         }
         _outputs[it.first] = res;
+        _batchedOutputsViews[it.first] = res;
     }
 }
 void AutoBatchInferRequest::SetBlobsToAnotherRequest(SoIInferRequestInternal& req) {
@@ -333,7 +335,11 @@ void AutoBatchInferRequest::CopyInputsIfNeeded() {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
+        auto blob = GetBlob(name);
+        // the user filled the view into the batched blob, so the data is already in place
+        if (blob == _batchedInputsViews[name])
+            continue;
+        CopyBlobIfNeeded(blob, _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
     }
 }
 
@@ -365,7 +371,11 @@ void AutoBatchInferRequest::CopyOutputsIfNeeded() {
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        auto blob = GetBlob(name);
+        // the batched request has written the results directly to the view
+        if (blob == _batchedOutputsViews[name])
+            continue;
+        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), blob, false);
     }
 }
 
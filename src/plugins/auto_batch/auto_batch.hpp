@@ -123,6 +123,9 @@ protected:
                                     const std::set<std::string>& batchedOutputs);
     size_t _batchId;
     size_t _batchSize;
+    // per-request views into the batched request blobs, the copy is needed only if the user replaced them
+    InferenceEngine::BlobMap _batchedInputsViews;
+    InferenceEngine::BlobMap _batchedOutputsViews;
 };
 
 class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <functional>
+#include <atomic>
 #include "lru_cache.h"
 
 namespace ov {
@@ -17,8 +18,15 @@ public:
         Hit,
         Miss
     };
+
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+    };
 public:
     virtual ~CacheEntryBase() = default;
+    virtual Statistics getStatistics() const = 0;
 };
 
 /**
@@ -40,6 +48,7 @@ public:
 
 public:
     explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    CacheEntry(size_t capacity, size_t shardsNum) : _impl(capacity, shardsNum) {}
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the builder functor and adds it to
@@ -52,6 +61,7 @@ public:
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
         if (0 == _impl.getCapacity()) {
             // fast track
+            _misses.fetch_add(1, std::memory_order_relaxed);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
@@ -63,11 +73,25 @@ public:
             if (retVal != retEmpty)
                 _impl.put(key, retVal);
         }
+        auto& counter = retStatus == LookUpStatus::Hit ? _hits : _misses;
+        counter.fetch_add(1, std::memory_order_relaxed);
         return {retVal, retStatus};
     }
 
+    Statistics getStatistics() const override {
+        Statistics result;
+        result.hits = _hits.load(std::memory_order_relaxed);
+        result.misses = _misses.load(std::memory_order_relaxed);
+        result.evictions = _impl.getEvictionsCount();
+        return result;
+    }
+
 public:
     ImplType _impl;
+
+private:
+    std::atomic_size_t _hits{0};
+    std::atomic_size_t _misses{0};
 };
 
 }   // namespace intel_cpu
@@ -9,5 +9,22 @@ namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+CacheEntryBase::Statistics MultiCache::getStatistics() const {
+    CacheEntryBase::Statistics result;
+    std::lock_guard<std::mutex> lock(_storageMutex);
+    for (const auto& item : _storage) {
+        const auto entryStat = item.second->getStatistics();
+        result.hits += entryStat.hits;
+        result.misses += entryStat.misses;
+        result.evictions += entryStat.evictions;
+    }
+    return result;
+}
+
+MultiCache& getJitKernelsCache() {
+    static MultiCache cache(jitKernelsCacheCapacity);
+    return cache;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -7,7 +7,9 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
+#include "sharded_lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -15,13 +17,16 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @note The implementation is thread safe, so a single instance may be shared between several graphs (e.g. all the streams
+ *       of an executable network). The records of each entry are distributed between lock-striped shards, so the concurrent
+ *       lookups from different threads rarely contend. The builder functor is called outside of any lock, so concurrent misses
+ *       for the same key may build the value several times, one of the results is stored.
  */
 
 class MultiCache {
 public:
     template<typename KeyType, typename ValueType>
-    using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    using EntryTypeT = CacheEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
@@ -29,9 +34,15 @@ public:
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param shardsNum number of shards each entry is split into. The single shard configuration guarantees the exact LRU eviction order.
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, size_t shardsNum = 1) : _capacity(capacity), _shardsNum(shardsNum) {}
+
+    MultiCache(const MultiCache& other) : _capacity(other._capacity), _shardsNum(other._shardsNum) {
+        std::lock_guard<std::mutex> lock(other._storageMutex);
+        _storage = other._storage;
+    }
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -49,6 +60,11 @@ public:
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Returns hit/miss/eviction counters accumulated over all the entries
+    */
+    CacheEntryBase::Statistics getStatistics() const;
+
 private:
     template<typename T>
     size_t getTypeId();
@@ -58,6 +74,8 @@ private:
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    size_t _shardsNum;
+    mutable std::mutex _storageMutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -71,9 +89,10 @@ template<typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_storageMutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity, _shardsNum)});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
@@ -82,5 +101,16 @@ MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
 using MultiCachePtr = std::shared_ptr<MultiCache>;
 using MultiCacheCPtr = std::shared_ptr<const MultiCache>;
 
+constexpr size_t jitKernelsCacheCapacity = 256;
+
+/**
+ * @brief Returns the process wide cache of the plugin JIT kernels which are generated from their configuration
+ * parameters only (no addresses of the node data are baked into the code) and are immutable after the generation.
+ * Such a kernel is generated once per process and is shared by all the nodes, streams and compiled models, so
+ * a model compiled again (e.g. reloaded) doesn't repeat the code generation. Each kernel type keeps up to
+ * jitKernelsCacheCapacity records.
+ */
+MultiCache& getJitKernelsCache();
+
 }   // namespace intel_cpu
 }   // namespace ov
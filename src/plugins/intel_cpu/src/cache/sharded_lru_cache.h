@@ -0,0 +1,121 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe lock-striped wrapper over the LruCache.
+ * The key space is split into several shards by the key hash, each shard is an independent LruCache protected by its own mutex,
+ * so concurrent lookups of different keys rarely contend on the same lock.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @note The LRU eviction policy is applied per shard, so with more than one shard the eviction order is only an approximation
+ *       of the global LRU order. The single shard configuration behaves exactly as the LruCache.
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template<typename Key, typename Value>
+class ShardedLruCache {
+public:
+    explicit ShardedLruCache(size_t capacity) : ShardedLruCache(capacity, 1) {}
+
+    /**
+     * @param capacity total maximum number of records
+     * @param shardsNum number of independent shards, the capacity is evenly distributed between them
+     */
+    ShardedLruCache(size_t capacity, size_t shardsNum) : _capacity(capacity) {
+        shardsNum = std::max<size_t>(1, std::min(shardsNum, std::max<size_t>(1, capacity)));
+        const size_t shardCapacity = (capacity + shardsNum - 1) / shardsNum;
+        _shards.reserve(shardsNum);
+        for (size_t i = 0; i < shardsNum; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+    void put(const Key &key, const Value &val) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard._mutex);
+        shard._impl.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+    Value get(const Key &key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard._mutex);
+        return shard._impl.get(key);
+    }
+
+    /**
+     * @brief Evicts up to n least recently used cache records from every shard
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->_mutex);
+            shard->_impl.evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the total number of records evicted from all the shards since the cache creation
+     * @return the number of evicted records
+     */
+    size_t getEvictionsCount() const {
+        size_t result = 0;
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->_mutex);
+            result += shard->_impl.getEvictionsCount();
+        }
+        return result;
+    }
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : _impl(capacity) {}
+        mutable std::mutex _mutex;
+        LruCache<Key, Value> _impl;
+    };
+
+    Shard& getShard(const Key& key) {
+        if (_shards.size() == 1) {
+            return *_shards.front();
+        }
+        // mix the high bits in, since the same hash value is used for the bucket selection inside the shard
+        size_t hash = static_cast<size_t>(key.hash());
+        hash ^= hash >> 17;
+        return *_shards[hash % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
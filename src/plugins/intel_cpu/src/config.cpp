@@ -149,6 +149,35 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARED == key) {
+            if (val == PluginConfigParams::YES) {
+                rtCacheShared = true;
+            } else if (val == PluginConfigParams::NO) {
+                rtCacheShared = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARED
+                           << ". Expected only YES/NO";
+            }
+        } else if (PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION == key) {
+            if (val == PluginConfigParams::YES) {
+                parallelGraphExecution = true;
+            } else if (val == PluginConfigParams::NO) {
+                parallelGraphExecution = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION
+                           << ". Expected only YES/NO";
+            }
+        } else if (PluginConfigInternalParams::KEY_CPU_CONSTANTS_CACHE_CAPACITY == key) {
+            long long val_i = -1;
+            try {
+                val_i = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_CONSTANTS_CACHE_CAPACITY
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the cache
+            constantsCacheCapacity = static_cast<size_t>(std::max(val_i, 0ll));
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
@@ -136,14 +136,18 @@ DnnlMemoryDescPtr Memory::GetDescWithType<DnnlMemoryDesc, 0, 0>() const {
 }
 
 void Memory::setDataHandle(void *data) {
+    size_t maxMemSize = pMemDesc->hasDefinedMaxSize() ?  pMemDesc->getMaxMemSize() : 0;
+    setDataHandle(data, maxMemSize);
+}
+
+void Memory::setDataHandle(void *data, size_t size) {
     if (!mgrHandle->hasExtBuffer()) {
         mgrHandle = DnnlMemMngrHandle(
             std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse())),
             this);
     }
 
-    size_t maxMemSize = pMemDesc->hasDefinedMaxSize() ?  pMemDesc->getMaxMemSize() : 0;
-    mgrHandle->setExtBuff(data, maxMemSize);
+    mgrHandle->setExtBuff(data, size);
     prim->set_data_handle(mgrHandle->getRawPtr()); // for pads zeroing, to preserve dnnl::memory::set_data_handle behaviour
 }
 
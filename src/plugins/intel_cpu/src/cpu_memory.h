@@ -181,6 +181,12 @@ public:
      */
     void setDataHandle(void* data);
 
+    /**
+     * @brief Resets the memory manager to a new one created with the provided raw memory of the given size in bytes.
+     * The memory keeps using the raw memory after the descriptor is redefined while the tensor fits into it.
+     */
+    void setDataHandle(void* data, size_t size);
+
     const MemoryDesc& getDesc() const {
         return *pMemDesc;
     }
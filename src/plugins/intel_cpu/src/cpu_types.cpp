@@ -199,6 +199,7 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "PriorBoxClustered", Type::PriorBoxClustered},
         {"Interaction", Type::Interaction},
         { "MHA", Type::MHA},
+        { "GridSample", Type::GridSample},
 };
 
 Type TypeFromName(const std::string& type) {
@@ -394,6 +395,8 @@ std::string NameFromType(const Type type) {
             return "Subgraph";
         case Type::MHA:
             return "MHA";
+        case Type::GridSample:
+            return "GridSample";
         default:
             return "Unknown";
     }
@@ -109,7 +109,8 @@ enum class Type {
     PriorBox,
     PriorBoxClustered,
     Interaction,
-    MHA
+    MHA,
+    GridSample
 };
 
 enum class Algorithm {
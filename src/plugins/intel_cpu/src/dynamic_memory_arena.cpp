@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_memory_arena.h"
+
+#include "utils/general_utils.h"
+
+#include <common/primitive_hashing_utils.hpp>
+#include <algorithm>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr size_t arenaAlignment = 64;  // bytes, the same as the alignment of the arena block itself
+}  // namespace
+
+size_t DynamicMemoryArena::PlanKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& dims : signature) {
+        seed = get_vector_hash(seed, dims);
+    }
+    return seed;
+}
+
+bool DynamicMemoryArena::PlanKey::operator==(const PlanKey& rhs) const {
+    return signature == rhs.signature;
+}
+
+DynamicMemoryArena::DynamicMemoryArena(std::vector<MemorySolver::Box> boxes, size_t plansCacheCapacity)
+    : _boxes(std::move(boxes)), _plans(plansCacheCapacity) {
+    _memMngrs.reserve(_boxes.size());
+    for (size_t i = 0; i < _boxes.size(); i++) {
+        IE_ASSERT(_boxes[i].id == static_cast<int64_t>(i)) << "Unexpected box id in the dynamic memory arena";
+        _memMngrs.push_back(
+            std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse())));
+    }
+}
+
+void DynamicMemoryArena::prepare(const Signature& signature) {
+    auto plan = _plans.get({signature});
+    if (!plan || plan == _currentPlan)
+        return;
+
+    // the growth reallocates the block, so all the boxes must be moved to the new one below
+    if (plan->totalSize > _arenaSize) {
+        _arena.resize(plan->totalSize);
+        _arenaSize = plan->totalSize;
+    }
+
+    auto* base = static_cast<uint8_t*>(_arena.getRawPtr());
+    for (size_t i = 0; i < _memMngrs.size(); i++) {
+        _memMngrs[i]->setExtBuff(base + plan->offsets[i], plan->sizes[i]);
+    }
+    _currentPlan = plan;
+}
+
+void DynamicMemoryArena::update(const Signature& signature, const std::vector<size_t>& sizes) {
+    IE_ASSERT(sizes.size() == _boxes.size()) << "Unexpected number of the box sizes in the dynamic memory arena";
+
+    const PlanKey key{signature};
+    auto cachedPlan = _plans.get(key);
+    if (cachedPlan) {
+        bool fits = true;
+        for (size_t i = 0; i < sizes.size() && fits; i++) {
+            fits = sizes[i] <= cachedPlan->sizes[i];
+        }
+        if (fits)
+            return;
+    }
+
+    auto plan = std::make_shared<Plan>();
+    plan->sizes.resize(sizes.size());
+    plan->offsets.resize(sizes.size());
+
+    std::vector<MemorySolver::Box> boxes = _boxes;
+    for (size_t i = 0; i < boxes.size(); i++) {
+        // never shrink the slots of the signature, the sizes may depend on something else than the graph inputs
+        size_t size = cachedPlan ? std::max(sizes[i], cachedPlan->sizes[i]) : sizes[i];
+        size = div_up(size, arenaAlignment);
+        plan->sizes[i] = size * arenaAlignment;
+        boxes[i].size = static_cast<int64_t>(size);
+    }
+
+    MemorySolver solver(boxes);
+    plan->totalSize = static_cast<size_t>(solver.solve()) * arenaAlignment;
+    for (size_t i = 0; i < boxes.size(); i++) {
+        plan->offsets[i] = static_cast<size_t>(solver.getOffset(static_cast<int>(i))) * arenaAlignment;
+    }
+
+    _plans.put(key, plan);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+#include "cpu_shape.h"
+#include "cache/lru_cache.h"
+
+#include <memory_solver.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Single block storage for the intermediate tensors of a dynamic graph.
+ *
+ * The sizes of the dynamic tensors are known only during the inference, so each box (a cluster of edges sharing
+ * the same memory) gets its own memory manager which allocates the memory on demand. After the inference the actual
+ * sizes are recorded and the MemorySolver places all the boxes into one arena block, the same way the static
+ * workspace is planned. The placement is cached by the shape signature (the graph input shapes) and applied before
+ * the next inference with the same signature, so the repeated shapes don't cause any reallocation.
+ * A box outgrowing its slot in the arena falls back to the own allocation of its memory manager, thus the current
+ * placement is always safe to use for any signature.
+ */
+class DynamicMemoryArena {
+public:
+    using Signature = std::vector<VectorDims>;
+
+    /**
+     * @param boxes live time of the boxes, the box id must be equal to its index in the vector, the size is ignored
+     * @param plansCacheCapacity maximum number of the cached placements
+     */
+    DynamicMemoryArena(std::vector<MemorySolver::Box> boxes, size_t plansCacheCapacity);
+
+    size_t getBoxesCount() const {
+        return _boxes.size();
+    }
+
+    const DnnlMemoryMngrPtr& getMemoryMngr(size_t boxIdx) const {
+        return _memMngrs[boxIdx];
+    }
+
+    /**
+     * @brief Applies the placement cached for the signature, if any. Must be called before the inference.
+     * The intermediate data stored in the boxes are not preserved.
+     */
+    void prepare(const Signature& signature);
+
+    /**
+     * @brief Records the actual sizes of the boxes (in bytes) observed during the inference with the given signature
+     * and plans the placement for the next inference with the same signature.
+     */
+    void update(const Signature& signature, const std::vector<size_t>& sizes);
+
+    /**
+     * @brief Returns the current size of the arena block in bytes
+     */
+    size_t getArenaSize() const {
+        return _arenaSize;
+    }
+
+private:
+    struct Plan {
+        std::vector<size_t> offsets;
+        std::vector<size_t> sizes;
+        size_t totalSize = 0;
+    };
+    using PlanPtr = std::shared_ptr<const Plan>;
+
+    struct PlanKey {
+        Signature signature;
+        size_t hash() const;
+        bool operator==(const PlanKey& rhs) const;
+    };
+
+    std::vector<MemorySolver::Box> _boxes;
+    std::vector<DnnlMemoryMngrPtr> _memMngrs;
+    LruCache<PlanKey, PlanPtr> _plans;
+    PlanPtr _currentPlan;
+    MemoryMngrWithReuse _arena;
+    size_t _arenaSize = 0;
+};
+
+using DynamicMemoryArenaPtr = std::shared_ptr<DynamicMemoryArena>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -26,6 +26,7 @@
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
@@ -119,6 +120,13 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
 
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+    if (_cfg.rtCacheShared && streams > 1) {
+        // keep the same total records limit as the per stream caches would have
+        _rtParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity * streams, streams);
+    }
+    if (_cfg.constantsCacheCapacity > 0) {
+        _constantsCacheUser = ConstantsCache::getInstance().use();
+    }
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
     if (_cfg.streamExecutorConfig._streams != 0) {
@@ -180,7 +188,7 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId], _mutex);
+                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId], _mutex, _rtParamsCache);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -286,6 +294,43 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
 InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const {
     if (_graphs.empty())
         IE_THROW() << "No graph was found";
+
+    // The statistics are collected from all the graphs, which are locked one by one,
+    // so they have to be handled before the graph of the current stream is locked
+    if (!isLegacyAPI()) {
+        if (name == ov::intel_cpu::runtime_cache_statistics) {
+            const auto stat = GetRuntimeCacheStatistics();
+            const auto shapeInferStat = GetShapeInferCacheStatistics();
+            return decltype(ov::intel_cpu::runtime_cache_statistics)::value_type{
+                {"HITS", stat.hits},
+                {"MISSES", stat.misses},
+                {"EVICTIONS", stat.evictions},
+                {"SHAPE_INFER_HITS", shapeInferStat.hits},
+                {"SHAPE_INFER_MISSES", shapeInferStat.misses},
+                {"SHAPE_INFER_EVICTIONS", shapeInferStat.evictions}};
+        } else if (name == ov::intel_cpu::constants_cache_statistics) {
+            uint64_t hits = 0;
+            for (auto& graph : _graphs) {
+                auto graphLock = GraphGuard::Lock(graph);
+                if (graph.IsReady())
+                    hits += graph.GetRestoredConstantNodesCount();
+            }
+            return decltype(ov::intel_cpu::constants_cache_statistics)::value_type{
+                {"HITS", hits},
+                {"SIZE", ConstantsCache::getInstance().getSize()}};
+        } else if (name == ov::intel_cpu::reference_fallback_statistics) {
+            decltype(ov::intel_cpu::reference_fallback_statistics)::value_type result;
+            for (auto& graph : _graphs) {
+                auto graphLock = GraphGuard::Lock(graph);
+                if (!graph.IsReady())
+                    continue;
+                for (const auto& item : graph.GetReferenceFallbackStatistics())
+                    result[item.first] += item.second;
+            }
+            return result;
+        }
+    }
+
     // @todo Can't we just use local copy (_cfg) instead?
     auto graphLock = GetGraph();
     const auto& graph = graphLock._graph;
@@ -311,6 +356,11 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
+            RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+            RO_property(ov::intel_cpu::constants_cache_statistics.name()),
+            RO_property(ov::intel_cpu::weights_numa_placement.name()),
+            RO_property(ov::intel_cpu::io_copy_statistics.name()),
+            RO_property(ov::intel_cpu::reference_fallback_statistics.name()),
         };
     }
 
@@ -353,12 +403,63 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = config.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::weights_numa_placement) {
+        decltype(ov::intel_cpu::weights_numa_placement)::value_type result;
+        for (const auto& item : _numaNodesWeights.getPlacement()) {
+            const std::string prefix = "NODE_" + std::to_string(item.first);
+            result[prefix + "_TOTAL"] = item.second.totalSize;
+            result[prefix + "_LOCAL"] = item.second.localSize;
+        }
+        return result;
+    } else if (name == ov::intel_cpu::io_copy_statistics) {
+        auto counter = [&](IOCopyReason reason) {
+            return _ioCopyCounters[static_cast<size_t>(reason)].load();
+        };
+        return decltype(ov::intel_cpu::io_copy_statistics)::value_type{
+            {"ZERO_COPY", counter(IOCopyReason::ZeroCopy)},
+            {"PRECISION", counter(IOCopyReason::Precision)},
+            {"LAYOUT", counter(IOCopyReason::Layout)},
+            {"PREPROCESSING", counter(IOCopyReason::Preprocessing)},
+            {"DYNAMIC_BATCH", counter(IOCopyReason::DynamicBatch)},
+            {"IN_PLACE", counter(IOCopyReason::InPlace)},
+            {"CAPACITY", counter(IOCopyReason::Capacity)}};
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
     return GetMetricLegacy(name, graph);
 }
 
+CacheEntryBase::Statistics ExecNetwork::GetRuntimeCacheStatistics() const {
+    if (_rtParamsCache) {
+        return _rtParamsCache->getStatistics();
+    }
+    CacheEntryBase::Statistics result;
+    for (auto& graph : _graphs) {
+        auto graphLock = GraphGuard::Lock(graph);
+        if (!graph.IsReady() || !graph.getRuntimeCache())
+            continue;
+        const auto graphStat = graph.getRuntimeCache()->getStatistics();
+        result.hits += graphStat.hits;
+        result.misses += graphStat.misses;
+        result.evictions += graphStat.evictions;
+    }
+    return result;
+}
+
+CacheEntryBase::Statistics ExecNetwork::GetShapeInferCacheStatistics() const {
+    CacheEntryBase::Statistics result;
+    for (auto& graph : _graphs) {
+        auto graphLock = GraphGuard::Lock(graph);
+        if (!graph.IsReady())
+            continue;
+        const auto graphStat = graph.GetShapeInferCacheStatistics();
+        result.hits += graphStat.hits;
+        result.misses += graphStat.misses;
+        result.evictions += graphStat.evictions;
+    }
+    return result;
+}
+
 bool ExecNetwork::canBeExecViaLegacyDynBatch(std::shared_ptr<const ov::Model> function, int64_t& maxBatchSize) const {
     maxBatchSize = -1;
     auto isDynBatchWithUpperBound = [maxBatchSize](const ov::PartialShape& shape) -> bool {
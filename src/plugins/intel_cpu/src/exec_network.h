@@ -11,6 +11,8 @@
 #include "extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
 
+#include <array>
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <map>
@@ -20,6 +22,20 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief The way the inference input or output data is passed between the user tensor and the graph memory
+ */
+enum class IOCopyReason : size_t {
+    ZeroCopy,
+    Precision,
+    Layout,
+    Preprocessing,
+    DynamicBatch,
+    InPlace,
+    Capacity,
+    Count
+};
+
 class ExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
     typedef std::shared_ptr<ExecNetwork> Ptr;
@@ -70,6 +86,12 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                    _numaNodesWeights;
+    // Runtime parameters cache shared by all the streams (nullptr means that each graph owns a private cache)
+    MultiCachePtr                               _rtParamsCache;
+    // Keeps the process wide constants cache entries alive while the model is loaded, nullptr if the cache is disabled
+    std::shared_ptr<void>                       _constantsCacheUser;
+    // Inputs and outputs passed by the infer requests, indexed by IOCopyReason
+    mutable std::array<std::atomic<uint64_t>, static_cast<size_t>(IOCopyReason::Count)> _ioCopyCounters{};
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -85,6 +107,10 @@ protected:
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const GraphGuard& graph) const;
+
+    // The statistics getters lock every graph, so the caller must not hold any graph lock
+    CacheEntryBase::Statistics GetRuntimeCacheStatistics() const;
+    CacheEntryBase::Statistics GetShapeInferCacheStatistics() const;
 };
 
 }   // namespace intel_cpu
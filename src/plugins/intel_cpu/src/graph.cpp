@@ -10,6 +10,7 @@
 #include <unordered_set>
 #include <limits>
 #include <fstream>
+#include <sstream>
 #include <unordered_map>
 #include <memory>
 #include <utility>
@@ -26,8 +27,10 @@
 #include <nodes/reorder.h>
 #include "nodes/convert.h"
 #include "nodes/subgraph.h"
+#include "nodes/reference.h"
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -41,6 +44,7 @@
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
 #include "utils/verbose.h"
+#include "utils/numa_utils.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
 #include <ngraph/node.hpp>
@@ -50,6 +54,7 @@
 #include <transformations/utils/utils.hpp>
 #include <low_precision/low_precision.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include <common/primitive_hashing_utils.hpp>
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -61,6 +66,9 @@ namespace intel_cpu {
 typedef std::unordered_set<EdgePtr> edge_cluster_t;
 typedef std::vector<edge_cluster_t> edge_clusters_t;
 
+// maximum number of the distinct input shapes signatures the dynamic memory arena layout is kept for
+static const size_t dynamicArenaPlansCapacity = 64;
+
 dnnl::engine Graph::eng(dnnl::engine::kind::cpu, 0);
 
 Graph::~Graph() {
@@ -69,7 +77,7 @@ Graph::~Graph() {
 
 template<typename NET>
 void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
-        WeightsSharing::Ptr &w_cache, const std::shared_ptr<std::mutex>& mutex) {
+        WeightsSharing::Ptr &w_cache, const std::shared_ptr<std::mutex>& mutex, const MultiCachePtr& rtCache) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "CreateGraph");
 
     if (IsReady())
@@ -77,7 +85,7 @@ void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
     // disable weights caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
 
-    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    rtParamsCache = rtCache ? rtCache : std::make_shared<MultiCache>(config.rtCacheCapacity);
     sharedMutex = mutex;
 
     Replicate(net, extMgr);
@@ -121,9 +129,9 @@ void Graph::CreateGraph(const std::vector<NodePtr> &graphNodes,
 }
 
 template void Graph::CreateGraph(const std::shared_ptr<const ngraph::Function>&,
-        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const std::shared_ptr<std::mutex>& mutex);
+        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const std::shared_ptr<std::mutex>& mutex, const MultiCachePtr&);
 template void Graph::CreateGraph(const CNNNetwork&,
-        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const std::shared_ptr<std::mutex>& mutex);
+        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const std::shared_ptr<std::mutex>& mutex, const MultiCachePtr&);
 
 void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const ExtensionManager::Ptr& extMgr) {
     this->_name = "subgraph";
@@ -158,6 +166,9 @@ void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const Ex
 
         node->setRuntimeCache(rtParamsCache);
         node->setSharedMutex(sharedMutex);
+        if (config.constantsCacheCapacity > 0) {
+            node->initOpSignature(op);
+        }
 
         graphNodes.push_back(node);
 
@@ -272,6 +283,9 @@ void Graph::Replicate(const CNNNetwork &network, const ExtensionManager::Ptr& ex
 
         node->setRuntimeCache(rtParamsCache);
         node->setSharedMutex(sharedMutex);
+        if (config.constantsCacheCapacity > 0) {
+            node->initOpSignature(op);
+        }
 
         graphNodes.push_back(node);
 
@@ -414,7 +428,7 @@ void Graph::InitGraph() {
 #endif
     ExtractConstantAndExecutableNodes();
 
-    ExecuteConstantNodesOnly();
+    restoredConstantNodes = ExecuteConstantNodesOnly();
 }
 
 void Graph::InitNodes() {
@@ -480,9 +494,162 @@ void Graph::ExtractConstantAndExecutableNodes() {
             executableGraphNodes.emplace_back(graphNode);
         }
     }
+
+    if (parallelExecution) {
+        int levelsNum = 0;
+        for (const auto& level : nodeLevels)
+            levelsNum = std::max(levelsNum, level.second + 1);
+        executableGraphLevels.resize(levelsNum);
+        for (const auto& node : executableGraphNodes)
+            executableGraphLevels[nodeLevels.at(node.get())].push_back(node);
+        executableGraphLevels.erase(std::remove_if(executableGraphLevels.begin(), executableGraphLevels.end(),
+                                                   [](const std::vector<NodePtr>& level) { return level.empty(); }),
+                                    executableGraphLevels.end());
+    }
+}
+
+bool Graph::IsParallelExecutionApplicable() const {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.parallelGraphExecution)
+        return false;
+    // dynamic nodes reallocate their memory at runtime and the memory state nodes rely on the sequential execution order
+    return std::none_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+        return node->isDynamicNode() || one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput);
+    });
+#else
+    // nested parallel regions of the OMP and SEQ runtimes are serialized, so the concurrent nodes would run single threaded
+    return false;
+#endif
+}
+
+void Graph::InitExecutionLevels() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitExecutionLevels");
+    nodeLevels.clear();
+    // graphNodes are sorted topologically, so all the parents are already visited
+    for (const auto& node : graphNodes) {
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            level = std::max(level, nodeLevels.at(parent.get()) + 1);
+        }
+        nodeLevels[node.get()] = level;
+    }
+}
+
+int Graph::GetMemoryTimestamp(const NodePtr& node) const {
+    return parallelExecution ? nodeLevels.at(node.get()) : node->execIndex;
+}
+
+namespace {
+using dnnl::impl::hash_combine;
+
+void describeMemoryDesc(std::ostringstream& stream, const MemoryDesc& desc) {
+    stream << desc.getPrecision().name() << ':';
+    auto describeDims = [&stream](const VectorDims& dims) {
+        stream << '[';
+        for (auto dim : dims)
+            stream << dim << ',';
+        stream << ']';
+    };
+    if (desc.getType() & MemoryDescType::Blocked) {
+        const auto blocked = desc.as<BlockedMemoryDesc>();
+        for (const auto& dims : {blocked->getShape().getStaticDims(), blocked->getBlockDims(), blocked->getOrder(),
+                                 blocked->getStrides(), blocked->getOffsetPaddingToData()})
+            describeDims(dims);
+        stream << blocked->getOffsetPadding();
+    } else {
+        stream << desc.serializeFormat();
+        describeDims(desc.getShape().getStaticDims());
+    }
+    stream << ';';
+}
+
+/**
+ * Identifies the outputs of the constant nodes by the content of the constant subgraphs producing them:
+ * the data of the constant inputs, the types and the attributes of the operations, the layouts of the edges
+ * and the implementations. The nodes missing in the result can't be identified (e.g. have fused operations).
+ *
+ * The signature of a node describes the node itself and refers to the parents by their key hashes, and the constants
+ * of the parents are merged without the duplicates, so the keys size grows linearly with the subgraph size.
+ */
+std::unordered_map<const Node*, ConstantsCache::Key> getConstantNodesKeys(const std::vector<NodePtr>& constantNodes) {
+    std::unordered_map<const Node*, ConstantsCache::Key> keys;
+    for (const auto& node : constantNodes) {
+        if (node->getOpSignature().empty() || !node->getFusedWith().empty() || !node->getMergeWith().empty())
+            continue;
+
+        const auto selectedPd = node->getSelectedPrimitiveDescriptor();
+        if (!selectedPd)
+            continue;
+
+        ConstantsCache::Key key;
+        std::ostringstream signature;
+        signature << node->getOpSignature() << '/' << static_cast<int>(selectedPd->getImplementationType()) << '(';
+
+        if (node->getType() == Type::Input) {
+            const auto memory = std::static_pointer_cast<node::Input>(node)->getMemoryPtr();
+            if (!memory || !memory->getDesc().isDefined())
+                continue;
+            describeMemoryDesc(signature, memory->getDesc());
+            key.hash = WeightsSharing::GetHashFunc().hash(static_cast<const unsigned char*>(memory->GetData()),
+                                                          memory->GetSize());
+            key.constants.push_back(memory);
+        }
+
+        bool identified = true;
+        std::unordered_set<const Memory*> constants;
+        for (size_t i = 0; i < node->getParentEdges().size() && identified; i++) {
+            const auto edge = node->getParentEdgeAt(i);
+            const auto parentKey = keys.find(edge->getParent().get());
+            if (parentKey == keys.end() || !edge->getDesc().isDefined()) {
+                identified = false;
+                break;
+            }
+            signature << '#' << parentKey->second.hash << '>' << edge->getInputNum() << '>'
+                      << edge->getOutputNum() << ':';
+            describeMemoryDesc(signature, edge->getDesc());
+            // the constants shared by the parents are kept once, in the order of the first reference
+            for (const auto& constant : parentKey->second.constants) {
+                if (constants.insert(constant.get()).second)
+                    key.constants.push_back(constant);
+            }
+        }
+        signature << ")->(";
+
+        for (size_t i = 0; i < node->getChildEdges().size() && identified; i++) {
+            const auto edge = node->getChildEdgeAt(i);
+            if (!edge->getDesc().isDefined()) {
+                identified = false;
+                break;
+            }
+            signature << edge->getInputNum() << ':';
+            describeMemoryDesc(signature, edge->getDesc());
+        }
+        signature << ')';
+
+        if (identified) {
+            key.signature = signature.str();
+            // the parents hashes are the part of the signature, so the hash covers the whole subgraph
+            key.hash = hash_combine(key.hash, key.signature);
+            keys[node.get()] = std::move(key);
+        }
+    }
+    return keys;
+}
+
+// the memory of the every output port of the node, the ports without the child edges are skipped
+std::map<int, MemoryPtr> getOutputMemories(const NodePtr& node) {
+    std::map<int, MemoryPtr> outputs;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        const auto edge = node->getChildEdgeAt(i);
+        if (!outputs.count(edge->getInputNum()))
+            outputs[edge->getInputNum()] = edge->getMemoryPtr();
+    }
+    return outputs;
 }
+}   // namespace
 
-void Graph::ExecuteConstantNodesOnly() const {
+size_t Graph::ExecuteConstantNodesOnly() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ExecuteConstantNodesOnly");
     dnnl::stream stream(eng);
 
@@ -510,20 +677,106 @@ void Graph::ExecuteConstantNodesOnly() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    // The results of the constant nodes consumed by the non constant ones are taken from the process wide cache
+    // when the same constant subgraph has been executed by another compilation. The constant nodes required
+    // only by such restored nodes are not executed at all.
+    std::unordered_map<const Node*, ConstantsCache::Key> cacheKeys;
+    std::unordered_map<const Node*, std::map<int, MemoryCPtr>> cachedOutputs;
+    std::unordered_set<const Node*> requiredNodes;
+    const bool useConstantsCache = config.constantsCacheCapacity > 0;
+    if (useConstantsCache) {
+        auto& constantsCache = ConstantsCache::getInstance();
+        cacheKeys = getConstantNodesKeys(constantGraphNodes);
+
+        for (auto it = constantGraphNodes.rbegin(); it != constantGraphNodes.rend(); ++it) {
+            const auto& node = *it;
+            bool required = node->getChildEdges().empty();
+            bool consumedByNonConstant = false;
+            for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+                const auto child = node->getChildEdgeAt(i)->getChild();
+                if (!child->isConstant())
+                    consumedByNonConstant = true;
+                else if (requiredNodes.count(child.get()))
+                    required = true;
+            }
+
+            if (consumedByNonConstant && !required) {
+                const auto key = cacheKeys.find(node.get());
+                std::map<int, MemoryCPtr> outputs;
+                if (key != cacheKeys.end() && node->getType() != Type::Input) {
+                    for (const auto& output : getOutputMemories(node)) {
+                        auto cached = constantsCache.get(key->second, output.first);
+                        if (!cached || cached->GetSize() != output.second->GetSize() ||
+                            !cached->getDesc().isCompatible(output.second->getDesc())) {
+                            outputs.clear();
+                            break;
+                        }
+                        outputs[output.first] = cached;
+                    }
+                }
+                if (outputs.empty())
+                    required = true;
+                else
+                    cachedOutputs[node.get()] = std::move(outputs);
+            }
+
+            if (required)
+                requiredNodes.insert(node.get());
+        }
+    }
+
+    size_t restoredCount = 0;
+    auto executeOrRestore = [&](const NodePtr& node) {
+        if (!useConstantsCache) {
+            ExecuteNode(node, stream);
+            return;
+        }
+
+        const auto cached = cachedOutputs.find(node.get());
+        if (cached != cachedOutputs.end()) {
+            const auto outputs = getOutputMemories(node);
+            for (const auto& output : cached->second) {
+                const auto& memory = outputs.at(output.first);
+                cpu_memcpy(memory->GetData(), output.second->GetData(), memory->GetSize());
+            }
+            restoredCount++;
+            return;
+        }
+
+        if (!requiredNodes.count(node.get()))
+            return;
+
+        ExecuteNode(node, stream);
+
+        const auto key = cacheKeys.find(node.get());
+        if (key == cacheKeys.end() || node->getType() == Type::Input)
+            return;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            if (!node->getChildEdgeAt(i)->getChild()->isConstant()) {
+                for (const auto& output : getOutputMemories(node))
+                    ConstantsCache::getInstance().put(key->second, output.first, *output.second,
+                                                      config.constantsCacheCapacity);
+                break;
+            }
+        }
+    };
+
     for (const auto &node : constantGraphNodes) {
         if (weightsCache) {
             auto sharedOutputs = acquireSharedOutputs(node);
 
             if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
-                ExecuteNode(node, stream);
+                executeOrRestore(node);
 
                 for (auto & output : std::get<2>(sharedOutputs))
                     output->valid(true);
             }
         } else {
-            ExecuteNode(node, stream);
+            executeOrRestore(node);
         }
     }
+
+    return restoredCount;
 }
 
 static bool isReorderAvailable(const MemoryDescPtr& parentDesc, const MemoryDescPtr& childDesc, const dnnl::engine& eng) {
@@ -666,6 +919,9 @@ static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges)
 }
 
 void Graph::AllocateWithReuse() {
+    dynamicArena.reset();
+    dynamicArenaClusters.clear();
+
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
     size_t edge_clusters_count = edge_clusters.size();
@@ -700,12 +956,13 @@ void Graph::AllocateWithReuse() {
 
     std::vector<MemorySolver::Box> definedBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
+    std::vector<MemorySolver::Box> arenaBoxes;
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, i };
         int64_t boxSize = 0;
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = GetMemoryTimestamp(edge->getParent());
+            int e_finish = GetMemoryTimestamp(edge->getChild());
 
             if (boxSize != -1 && edge->getDesc().hasDefinedMaxSize()) {
                 int64_t e_size = edge->getDesc().getMaxMemSize();  // size in bytes (from the beginning of data to the last element)
@@ -743,7 +1000,13 @@ void Graph::AllocateWithReuse() {
             definedBoxes.push_back(box);
         } else {
             box.size = boxSize;
-            undefinedBoxes.push_back(box);
+            // The intermediate dynamic tensors are placed into the arena, while the graph inputs and outputs
+            // must keep their data between the inferences
+            if (isInput | isOutput | isConst) {
+                undefinedBoxes.push_back(box);
+            } else {
+                arenaBoxes.push_back(box);
+            }
         }
     }
 
@@ -752,6 +1015,10 @@ void Graph::AllocateWithReuse() {
 
     memWorkspace = std::make_shared<Memory>(eng);
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
+    // the activations are local to the stream as well as its weights replica
+    if (weightsCache && weightsCache->getNumaNodeId() >= 0) {
+        bindToNumaNode(memWorkspace->GetData(), total_size, weightsCache->getNumaNodeId());
+    }
 
     if (edge_clusters.empty())
         return;
@@ -812,6 +1079,51 @@ void Graph::AllocateWithReuse() {
             }
         }
     }
+
+    if (!arenaBoxes.empty()) {
+        dynamicArenaClusters.reserve(arenaBoxes.size());
+        for (size_t i = 0; i < arenaBoxes.size(); i++) {
+            auto& box = arenaBoxes[i];
+            dynamicArenaClusters.emplace_back(edge_clusters[box.id].begin(), edge_clusters[box.id].end());
+            box.id = i;
+        }
+
+        dynamicArena = std::make_shared<DynamicMemoryArena>(arenaBoxes, dynamicArenaPlansCapacity);
+        for (size_t i = 0; i < dynamicArenaClusters.size(); i++) {
+            for (auto& edge : dynamicArenaClusters[i]) {
+                if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                    edge->allocate(dynamicArena->getMemoryMngr(i));
+                }
+            }
+        }
+    }
+}
+
+DynamicMemoryArena::Signature Graph::GetInputShapesSignature() const {
+    DynamicMemoryArena::Signature signature;
+    signature.reserve(inputNodesMap.size());
+    for (const auto& input : inputNodesMap) {
+        const auto& childEdges = input.second->getChildEdgesAtPort(0);
+        if (childEdges.empty() || !childEdges.front()->getMemory().getDesc().isDefined()) {
+            signature.emplace_back();
+            continue;
+        }
+        signature.push_back(childEdges.front()->getMemory().getStaticDims());
+    }
+    return signature;
+}
+
+void Graph::UpdateDynamicArena(const DynamicMemoryArena::Signature& signature) {
+    std::vector<size_t> sizes(dynamicArenaClusters.size(), 0);
+    for (size_t i = 0; i < dynamicArenaClusters.size(); i++) {
+        for (const auto& edge : dynamicArenaClusters[i]) {
+            const auto& desc = edge->getMemory().getDesc();
+            if (desc.isDefined()) {
+                sizes[i] = std::max(sizes[i], desc.getCurrentMemSize());
+            }
+        }
+    }
+    dynamicArena->update(signature, sizes);
 }
 
 void Graph::Allocate() {
@@ -822,6 +1134,10 @@ void Graph::Allocate() {
     //   NotAllocated - view on other blob, peer or in-place
     for (auto& edge : graphEdges) edge->init();
 
+    parallelExecution = IsParallelExecutionApplicable();
+    if (parallelExecution)
+        InitExecutionLevels();
+
     // Allocate memory space for all edges marked with NeedAllocation
     AllocateWithReuse();
 
@@ -1008,20 +1324,60 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
-    dnnl::stream stream(eng);
+    DynamicMemoryArena::Signature signature;
+    if (dynamicArena) {
+        signature = GetInputShapesSignature();
+        dynamicArena->prepare(signature);
+    }
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.verbose);
-        PERF(node, config.collectPerfCounters);
+    if (parallelExecution) {
+        InferByLevels(request);
+    } else {
+        dnnl::stream stream(eng);
 
-        if (request)
-            request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+
+            if (request)
+                request->ThrowIfCanceled();
+            ExecuteNode(node, stream);
+        }
     }
 
+    if (dynamicArena)
+        UpdateDynamicArena(signature);
+
     if (infer_count != -1) infer_count++;
 }
 
+void Graph::InferByLevels(InferRequestBase* request) {
+    dnnl::stream stream(eng);
+
+    for (const auto& level : executableGraphLevels) {
+        if (request)
+            request->ThrowIfCanceled();
+
+        if (level.size() == 1) {
+            const auto& node = level.front();
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+            ExecuteNode(node, stream);
+            continue;
+        }
+
+        // the nested parallel regions of the nodes are balanced between the branches by the TBB work stealing
+        parallel_for(level.size(), [&](size_t i) {
+            const auto& node = level[i];
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+            // dnnl stream object must not be used by several threads simultaneously
+            dnnl::stream nodeStream(eng);
+            ExecuteNode(node, nodeStream);
+        });
+    }
+}
+
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -1140,6 +1496,32 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
     }
 }
 
+CacheEntryBase::Statistics Graph::GetShapeInferCacheStatistics() const {
+    CacheEntryBase::Statistics result;
+    for (const auto& node : graphNodes) {
+        const auto nodeStat = node->getShapeInferCacheStatistics();
+        result.hits += nodeStat.hits;
+        result.misses += nodeStat.misses;
+        result.evictions += nodeStat.evictions;
+    }
+    return result;
+}
+
+std::map<std::string, uint64_t> Graph::GetReferenceFallbackStatistics() const {
+    std::map<std::string, uint64_t> result;
+    for (const auto& node : graphNodes) {
+        if (node->getType() != Type::Reference)
+            continue;
+        const auto reference = std::dynamic_pointer_cast<node::Reference>(node);
+        if (!reference)
+            continue;
+        const std::string prefix = reference->getOpTypeName() + ":" + node->getName() + ":";
+        result[prefix + "COUNT"] += reference->getExecCount();
+        result[prefix + "TIME_US"] += reference->getExecTime();
+    }
+    return result;
+}
+
 void Graph::setConfig(const Config &cfg) {
     config = cfg;
 }
@@ -11,11 +11,13 @@
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "dynamic_memory_arena.h"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_map>
 
 namespace ov {
 namespace intel_cpu {
@@ -36,11 +38,11 @@ public:
     Graph() = default;
     ~Graph();
 
-    Status GetStatus() {
+    Status GetStatus() const {
         return status;
     }
 
-    bool IsReady() {
+    bool IsReady() const {
         return (GetStatus() == Ready);
     }
 
@@ -54,7 +56,8 @@ public:
     void CreateGraph(NET &network,
                      const ExtensionManager::Ptr& extMgr,
                      WeightsSharing::Ptr &w_cache,
-                     const std::shared_ptr<std::mutex>& mutex);
+                     const std::shared_ptr<std::mutex>& mutex,
+                     const MultiCachePtr& rtCache = nullptr);
 
     void CreateGraph(const std::vector<NodePtr> &graphNodes,
                      const std::vector<EdgePtr> &graphEdges,
@@ -197,6 +200,29 @@ public:
         return graphHasDynamicInput;
     }
 
+    MultiCachePtr getRuntimeCache() const {
+        return rtParamsCache;
+    }
+
+    /**
+     * @brief Returns the shape inference cache counters accumulated over all the graph nodes
+     */
+    CacheEntryBase::Statistics GetShapeInferCacheStatistics() const;
+
+    /**
+     * @brief Returns the execution counters of the nodes performed by the reference implementations,
+     * see ov::intel_cpu::reference_fallback_statistics for the keys
+     */
+    std::map<std::string, uint64_t> GetReferenceFallbackStatistics() const;
+
+    /**
+     * @brief Returns the number of the constant nodes which outputs were restored from the process wide constants
+     * cache instead of the execution
+     */
+    size_t GetRestoredConstantNodesCount() const {
+        return restoredConstantNodes;
+    }
+
 protected:
     void VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes);
 
@@ -209,6 +235,11 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        nodeLevels.clear();
+        executableGraphLevels.clear();
+        parallelExecution = false;
+        dynamicArena.reset();
+        dynamicArenaClusters.clear();
     }
     Status status { NotReady };
     Config config;
@@ -243,8 +274,14 @@ protected:
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
+    bool IsParallelExecutionApplicable() const;
+    void InitExecutionLevels();
+    int GetMemoryTimestamp(const NodePtr& node) const;
+    void InferByLevels(InferRequestBase* request);
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
-    void ExecuteConstantNodesOnly() const;
+    size_t ExecuteConstantNodesOnly() const;
+    DynamicMemoryArena::Signature GetInputShapesSignature() const;
+    void UpdateDynamicArena(const DynamicMemoryArena::Signature& signature);
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -262,8 +299,21 @@ private:
     std::vector<NodePtr> constantGraphNodes;
     std::vector<NodePtr> executableGraphNodes;
 
+    // Parallel execution mode: the executable nodes are grouped by the dependency level (the longest path from the graph inputs).
+    // The levels are executed one after another, the nodes inside a level are independent and run concurrently.
+    // The memory reuse is planned in terms of levels, so the nodes of the same level never share memory.
+    bool parallelExecution = false;
+    std::unordered_map<const Node*, int> nodeLevels;
+    std::vector<std::vector<NodePtr>> executableGraphLevels;
+
+    // The intermediate dynamic tensors share the single memory block, which layout is planned per input shapes
+    // signature using the sizes observed during the previous inferences.
+    DynamicMemoryArenaPtr dynamicArena;
+    std::vector<std::vector<EdgePtr>> dynamicArenaClusters;
+
     MultiCachePtr rtParamsCache;
     std::shared_ptr<std::mutex> sharedMutex = nullptr;
+    size_t restoredConstantNodes = 0;
 
     void EnforceBF16();
 };
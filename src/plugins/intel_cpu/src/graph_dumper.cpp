@@ -291,6 +291,15 @@ void summary_perf(const Graph &graph) {
     std::cout << "Summary of " << graph.GetName() << " @" << std::hash<uint64_t>{}(reinterpret_cast<uint64_t>(&graph)) << std::endl;
     std::cout << "     Total(us): " << (uint64_t)(total) << std::endl;
     std::cout << " Total_avg(us): " << (uint64_t)(total_avg) << std::endl;
+    {
+        const auto shapeInferStat = graph.GetShapeInferCacheStatistics();
+        const auto lookups = shapeInferStat.hits + shapeInferStat.misses;
+        if (lookups > 0) {
+            std::cout << " shape_infer_cache: hits " << shapeInferStat.hits << " misses " << shapeInferStat.misses
+                      << " evictions " << shapeInferStat.evictions << " hit rate "
+                      << static_cast<int>(shapeInferStat.hits * 100 / lookups) << " %" << std::endl;
+        }
+    }
     {
         std::cout << " perf_by_type:" << std::endl;
         std::vector<std::pair<std::string, double> > A;
@@ -20,6 +20,7 @@
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/fullyconnected.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "onednn/dnnl.h"
@@ -27,6 +28,7 @@
 #include <blob_factory.hpp>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
+#include "ngraph_transformations/fc_weights_decompression.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -47,6 +49,7 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <numeric>
 
 #include "itt.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -61,7 +64,11 @@ namespace intel_cpu {
 GraphOptimizer::GraphOptimizer() {}
 
 void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseFCAndWeightsDecompression");
+    FuseFCAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -149,6 +156,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseReduceAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseSoftmaxAndSimpleOperation");
+    FuseSoftmaxAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEltwiseAndSimple");
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
@@ -164,6 +175,9 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
 void GraphOptimizer::ApplyImplSpecificGraphOptimizations(Graph &graph) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "GraphOptimizer::ApplyImplSpecificGraphOptimizations");
 
+    MergeConvertAndReorder(graph);
+    graph.RemoveDroppedNodes();
+
     DropDoubleReorders(graph);
     graph.RemoveDroppedNodes();
 
@@ -173,6 +187,199 @@ void GraphOptimizer::ApplyImplSpecificGraphOptimizations(Graph &graph) {
     graph.RemoveDroppedEdges();
 }
 
+void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableChainNode = [](const NodePtr& node) {
+        return node->getChildEdges().size() == 1 && node->getFusedWith().empty();
+    };
+
+    auto isFP32Constant = [](const NodePtr& node) {
+        return node->getType() == Type::Input && node->isConstant() && node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
+    };
+
+    // the port of the constant input of the binary eltwise, -1 if there is no such input
+    auto getConstantPort = [&](const NodePtr& eltwise) {
+        if (eltwise->getParentEdges().size() != 2)
+            return -1;
+        for (int port : {1, 0}) {
+            if (isFP32Constant(eltwise->getParentEdgesAtPort(port)[0]->getParent()))
+                return port;
+        }
+        return -1;
+    };
+
+    // PowerStatic is the scalar form of the decompression Subtract and Multiply: y = beta * x + gamma
+    auto isScalarEltwise = [](const NodePtr& node, float& beta, float& gamma) {
+        auto eltwise = std::dynamic_pointer_cast<Eltwise>(node);
+        if (!eltwise || eltwise->getAlgorithm() != Algorithm::EltwisePowerStatic || eltwise->getAlpha() != 1.0f)
+            return false;
+        beta = eltwise->getBeta();
+        gamma = eltwise->getGamma();
+        return true;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto fcNode = std::dynamic_pointer_cast<FullyConnected>(graphNodes[i]);
+        if (!fcNode || fcNode->getInputShapeAtPort(1).getRank() != 2 || fcNode->getInputShapeAtPort(0).getRank() > 3)
+            continue;
+
+        // the same checks are done by FoldUnfusedFCWeightsDecompression, which folds the weights otherwise
+        const auto& srcMinDims = fcNode->getInputShapeAtPort(0).getMinDims();
+        const size_t minRows = std::accumulate(srcMinDims.begin(), srcMinDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+        if (!is_decompression_kernel_applicable(minRows))
+            continue;
+
+        const auto& fcWeightsDims = fcNode->getInputShapeAtPort(1).getStaticDims();
+        const size_t OC = fcWeightsDims[0];
+        const size_t IC = fcWeightsDims[1];
+
+        // Constant (U8/I8) -> Convert -> [Subtract] -> Multiply -> [Reshape] -> FullyConnected
+        auto parent = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        NodePtr reshape;
+        if (parent->getType() == Type::Reshape) {
+            if (!isSuitableChainNode(parent))
+                continue;
+            reshape = parent;
+            parent = reshape->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        auto multiply = parent;
+        if (multiply->getType() != Type::Eltwise || !isSuitableChainNode(multiply))
+            continue;
+        int scalesPort = -1;
+        float scale = 0.f, shift = 0.f;
+        if (multiply->getAlgorithm() == Algorithm::EltwiseMultiply) {
+            scalesPort = getConstantPort(multiply);
+            if (scalesPort < 0)
+                continue;
+        } else if (!isScalarEltwise(multiply, scale, shift) || shift != 0.f) {
+            continue;
+        }
+        parent = multiply->getParentEdgesAtPort(scalesPort == 0 ? 1 : 0)[0]->getParent();
+
+        NodePtr subtract;
+        float zeroPoint = 0.f;
+        if (parent->getType() == Type::Eltwise && isSuitableChainNode(parent)) {
+            float beta = 0.f, gamma = 0.f;
+            if (parent->getAlgorithm() == Algorithm::EltwiseSubtract && getConstantPort(parent) == 1) {
+                subtract = parent;
+            } else if (isScalarEltwise(parent, beta, gamma) && beta == 1.0f) {
+                subtract = parent;
+                zeroPoint = -gamma;
+            } else {
+                continue;
+            }
+            parent = subtract->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        auto convert = parent;
+        if (convert->getType() != Type::Convert || !isSuitableChainNode(convert))
+            continue;
+        auto weights = convert->getParentEdgesAtPort(0)[0]->getParent();
+        const auto weightsPrc = weights->getOriginalOutputPrecisionAtPort(0);
+        if (weights->getType() != Type::Input || !weights->isConstant() || !one_of(weightsPrc, Precision::U8, Precision::I8) ||
+            weights->getChildEdges().size() != 1)
+            continue;
+
+        // the decompression is done in the [OC, G, IC / G] layout, the leading unit dimensions are skipped
+        const auto& chainDims = convert->getOutputShapeAtPort(0).getStaticDims();
+        size_t skippedDims = 0;
+        while (chainDims.size() - skippedDims > 2 && chainDims[skippedDims] == 1)
+            skippedDims++;
+        const size_t rank = chainDims.size() - skippedDims;
+        const size_t G = rank == 3 ? chainDims[skippedDims + 1] : 1;
+        if (rank > 3 || chainDims[skippedDims] != OC || chainDims.back() * G != IC)
+            continue;
+
+        // expands the per output channel and group constant to the [OC, G] values,
+        // the values varying inside of the group are not supported
+        auto getGroupValues = [&](const NodePtr& eltwise, int port, std::vector<float>& values) {
+            auto constNode = std::dynamic_pointer_cast<node::Input>(eltwise->getParentEdgesAtPort(port)[0]->getParent());
+            if (!constNode)
+                return false;
+            auto constDims = constNode->getOutputShapeAtPort(0).getStaticDims();
+            if (constDims.size() > chainDims.size())
+                return false;
+            constDims.insert(constDims.begin(), chainDims.size() - constDims.size(), 1);
+            for (size_t d = 0; d < skippedDims; d++) {
+                if (constDims[d] != 1)
+                    return false;
+            }
+            constDims.erase(constDims.begin(), constDims.begin() + skippedDims);
+            const size_t constOC = constDims[0];
+            const size_t constG = rank == 3 ? constDims[1] : 1;
+            if (constDims.back() != 1 || (constOC != 1 && constOC != OC) || (constG != 1 && constG != G))
+                return false;
+
+            const auto data = static_cast<const float*>(constNode->getMemoryPtr()->GetPtr());
+            values.resize(OC * G);
+            for (size_t oc = 0; oc < OC; oc++) {
+                for (size_t g = 0; g < G; g++)
+                    values[oc * G + g] = data[(constOC == 1 ? 0 : oc) * constG + (constG == 1 ? 0 : g)];
+            }
+            return true;
+        };
+
+        std::vector<float> scales(OC * G, scale);
+        if (scalesPort >= 0 && !getGroupValues(multiply, scalesPort, scales))
+            continue;
+
+        std::vector<float> zeroPoints;
+        if (subtract) {
+            zeroPoints.resize(OC * G, zeroPoint);
+            if (subtract->getAlgorithm() == Algorithm::EltwiseSubtract && !getGroupValues(subtract, 1, zeroPoints))
+                continue;
+        }
+
+        auto weightsNode = std::dynamic_pointer_cast<node::Input>(weights);
+        if (!weightsNode)
+            continue;
+        auto packedWeights = fcNode->fuseDecompression(weightsNode->getMemoryPtr(), std::move(scales), std::move(zeroPoints), IC / G);
+
+        // the compressed weights are connected to FullyConnected directly
+        if (scalesPort >= 0) {
+            auto p_edge = multiply->getParentEdgesAtPort(scalesPort)[0];
+            graph.RemoveEdge(p_edge);
+        }
+        graph.DropNode(multiply);
+        if (subtract) {
+            if (subtract->getAlgorithm() == Algorithm::EltwiseSubtract) {
+                auto p_edge = subtract->getParentEdgesAtPort(1)[0];
+                graph.RemoveEdge(p_edge);
+            }
+            graph.DropNode(subtract);
+        }
+        graph.DropNode(convert);
+
+        if (packedWeights) {
+            // the packed weights replace the compressed ones, so a single copy of the weights is kept
+            auto removeEdges = [&](const NodePtr& node) {
+                for (auto edges : {node->getParentEdges(), node->getChildEdges()}) {
+                    for (auto& weakEdge : edges) {
+                        if (auto edge = weakEdge.lock())
+                            graph.RemoveEdge(edge);
+                    }
+                }
+            };
+            removeEdges(weights);
+            if (reshape)
+                removeEdges(reshape);
+
+            auto packedNode = std::make_shared<node::Input>(packedWeights, weights->getName() + "_int4", "Input",
+                                                            graph.getEngine(), graph.weightsCache);
+            EdgePtr newEdge(new Edge(packedNode, fcNode, 0, 1));
+            fcNode->addEdge(newEdge);
+            graph.GetEdges().push_back(newEdge);
+            graphNodes.push_back(packedNode);
+        } else if (reshape) {
+            // the groups Reshape is kept, it just reinterprets the compressed weights
+            reshape->setOriginalInputPrecisionAtPort(0, weightsPrc);
+            reshape->setOriginalOutputPrecisionAtPort(0, weightsPrc);
+        }
+    }
+}
+
 void GraphOptimizer::FuseConvolutionMatMulAndBias(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1548,6 +1755,46 @@ void GraphOptimizer::FuseReduceAndSimpleOperation(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseSoftmaxAndSimpleOperation(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](NodePtr node) {
+        return node->getType() == Type::Softmax && node->getChildEdges().size() == 1;
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!parentNode->canFuse(childNode)) {
+            parent++;
+            continue;
+        }
+
+        childNode->fuseInto(parentNode);
+
+        if (childNode->getType() == Type::FakeQuantize || childNode->getType() == Type::Eltwise) {
+            auto parentEdges = childNode->parentEdges;
+            for (auto &parentEdge : parentEdges) {
+                auto p_edge = parentEdge.lock();
+                if (p_edge == nullptr)
+                    IE_THROW() << "Cannot get parent edge " << childNode->getName();
+                if (p_edge->getParent()->getType() == Type::Softmax)
+                    continue;
+
+                graph.RemoveEdge(p_edge);
+            }
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
 void GraphOptimizer::FuseEltwiseAndSimple(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1719,6 +1966,84 @@ void GraphOptimizer::DropDoubleReorders(Graph &graph) {
     }
 }
 
+void GraphOptimizer::MergeConvertAndReorder(Graph &graph) {
+    // Only the conversions which give the same result in Convert and in Reorder are merged:
+    // Convert truncates the floating point values to integers, while Reorder rounds them.
+    auto isSuitableConversion = [](const Precision& inPrc, const Precision& outPrc) {
+        if (outPrc == Precision::FP32)
+            return one_of(inPrc, Precision::U8, Precision::I8, Precision::I32, Precision::BF16);
+        if (outPrc == Precision::I32)
+            return one_of(inPrc, Precision::U8, Precision::I8);
+        return false;
+    };
+
+    auto isSuitableConvertNode = [&](const NodePtr& node) {
+        if (node->getType() != Type::Convert || !node->getFusedWith().empty() ||
+            node->getParentEdges().size() != 1 || node->getChildEdges().size() != 1)
+            return false;
+        const auto& config = node->getSelectedPrimitiveDescriptor()->getConfig();
+        return isSuitableConversion(config.inConfs[0].getMemDesc()->getPrecision(),
+                                    config.outConfs[0].getMemDesc()->getPrecision());
+    };
+
+    // The Reorder has to change the layout only: a narrowing Reorder (e.g. FP32 -> U8) around a widening Convert
+    // is not equivalent to a single conversion between the outer precisions.
+    auto isSuitableReorderNode = [](const NodePtr& node) {
+        auto reorder = std::dynamic_pointer_cast<Reorder>(node);
+        return reorder && !reorder->getOptimized() && reorder->getChildEdges().size() == 1 &&
+               reorder->getInput().getPrecision() == reorder->getOutput().getPrecision();
+    };
+
+    std::set<NodePtr> processed;
+    std::size_t graphNodesSize = graph.GetNodes().size();
+    for (std::size_t i = 0; i < graphNodesSize; i++) {
+        NodePtr convert = graph.GetNodes()[i];
+        if (processed.find(convert) != processed.end() || !isSuitableConvertNode(convert))
+            continue;
+
+        NodePtr first, second;
+        MemoryDescPtr inDesc, outDesc;
+        const auto child = convert->getChildEdgeAt(0)->getChild();
+        const auto parent = convert->getParentEdgeAt(0)->getParent();
+        if (isSuitableReorderNode(child) && processed.find(child) == processed.end()) {
+            first = convert;
+            second = child;
+            inDesc = convert->getParentEdgeAt(0)->getOutputDesc().clone();
+            outDesc = std::dynamic_pointer_cast<Reorder>(child)->getOutput().clone();
+        } else if (isSuitableReorderNode(parent) && processed.find(parent) == processed.end()) {
+            first = parent;
+            second = convert;
+            inDesc = std::dynamic_pointer_cast<Reorder>(parent)->getInput().clone();
+            outDesc = convert->getChildEdgeAt(0)->getInputDesc().clone();
+        } else {
+            continue;
+        }
+
+        NodePtr p = first->getParentEdgeAt(0)->getParent();
+        NodePtr c = second->getChildEdgeAt(0)->getChild();
+        const auto inNum = first->getParentEdgeAt(0)->getInputNum();
+        const auto outNum = second->getChildEdgeAt(0)->getOutputNum();
+
+        graph.DropNode(first);
+        graph.DropNode(second);
+
+        processed.insert(first);
+        processed.insert(second);
+
+        EdgePtr edge;
+        for (auto cur : p->getChildEdgesAtPort(inNum)) {
+            if (cur->getChild() == c && cur->getOutputNum() == outNum)
+                edge = cur;
+        }
+        if (!edge) IE_THROW() << "Inappropriate graph processing";
+
+        std::string layerName = edge->getParent()->getName() + "_" + Reorder::getReorderArgs(*inDesc, *outDesc) + "_" +
+                                edge->getChild()->getName();
+        graph.InsertReorder(edge, layerName, *inDesc, *outDesc, false);
+        graph.GetEdges().erase(std::remove(graph.GetEdges().begin(), graph.GetEdges().end(), edge), graph.GetEdges().end());
+    }
+}
+
 void GraphOptimizer::FuseBroadcastAndEltwise(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
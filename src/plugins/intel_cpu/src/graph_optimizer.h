@@ -20,6 +20,7 @@ public:
     void ApplyImplSpecificGraphOptimizations(Graph& graph);
 
 private:
+    void FuseFCAndWeightsDecompression(Graph &graph);
     void FuseConvolutionMatMulAndBias(Graph &graph);
     void FuseDeconvolutionAndSimpleOperation(Graph &graph);
     void FuseMultiplyAndAdd(Graph &graph);
@@ -35,8 +36,10 @@ private:
     void FuseInterpolateAndSimpleOperation(Graph &graph);
     void FuseNormalizeL2AndSimpleOperation(Graph &graph);
     void FuseReduceAndSimpleOperation(Graph &graph);
+    void FuseSoftmaxAndSimpleOperation(Graph &graph);
 
     void DropDoubleReorders(Graph& graph);
+    void MergeConvertAndReorder(Graph& graph);
     void FuseConvolutionAndZeroPoints(Graph &graph);
     void FuseBroadcastAndEltwise(Graph &graph);
     void FuseEltwiseAndSimple(Graph &graph);
@@ -4,6 +4,7 @@
 
 #include "infer_request.h"
 #include "dnnl_extension_utils.h"
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <map>
@@ -168,6 +169,7 @@ void InferRequestBase::InferImpl() {
     execDataPreprocessing(_inputs);
 
     changeDefaultPtr();
+    changeDynamicPtr();
 
     ThrowIfCanceled();
 
@@ -186,6 +188,8 @@ void InferRequestBase::InferImpl() {
     ThrowIfCanceled();
 
     graph->PullOutputData(_outputs);
+
+    countIOCopies();
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestBase::GetPerformanceCounts() const {
@@ -200,71 +204,101 @@ static inline void changeEdgePtr(const EdgePtr &edge, void *newPtr) {
     edge->getMemoryPtr()->setDataHandle(newPtr);
 }
 
-void InferRequestBase::changeDefaultPtr() {
-    for (auto& it : externalPtr) {
-        const auto& inputNodesMap = graph->GetInputNodesMap();
-        auto input = inputNodesMap.find(it.first);
-        if (input != inputNodesMap.end()) {
-            NodePtr inputNodePtr = input->second;
-            if (inputNodePtr->getChildEdgeAt(0)->getMemory().GetData() == it.second)
-                continue;
-            auto& childEdges = inputNodePtr->getChildEdges();
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (auto& childEdge : childEdges) {
-                auto ce = childEdge.lock();
-                if (!ce)
-                    IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
-
-                auto& child = ce->getChild();
-
-                if (child->isConstant()) {
-                    canBeInPlace = false;
-                    break;
-                }
+// Gives the edges back a common memory owned by the graph, the external memory they used may be released already
+static inline void resetEdgesPtr(const std::vector<EdgePtr> &edges) {
+    auto memMngr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse()));
+    for (auto& edge : edges) {
+        edge->getMemoryPtr()->Create(edge->getMemory().getDescPtr(), memMngr);
+    }
+}
 
-                if (child->getType() == Type::Concatenation) {
-                    auto concat = dynamic_cast<node::Concat*>(child.get());
-                    if (concat && concat->isOptimized()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
+static bool canBeInPlaceInput(const NodePtr &inputNodePtr) {
+    auto& childEdges = inputNodePtr->getChildEdges();
+    // Input cannot be in-place with other primitives
+    for (auto& childEdge : childEdges) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
 
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                if (child->getType() == Type::Split) {
-                    canBeInPlace = false;
-                    break;
-                }
+        auto& child = ce->getChild();
 
-                if (child->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
+        if (child->isConstant())
+            return false;
 
-                auto& edges = child->getChildEdges();
-                for (auto& edge : edges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+        if (child->getType() == Type::Concatenation) {
+            auto concat = dynamic_cast<node::Concat*>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+        }
 
-                    if (e->getMemory().GetData() == ce->getMemory().GetData()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        if (child->getType() == Type::Split)
+            return false;
+
+        if (child->isInPlace())
+            return false;
+
+        auto& edges = child->getChildEdges();
+        for (auto& edge : edges) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().GetData() == ce->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
 
-                if (!canBeInPlace)
-                    break;
+static bool canBeInPlaceOutput(const EdgePtr &parentEdge) {
+    void* defaultPtr = parentEdge->getMemory().GetData();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = parentEdge->getParent();
+    NodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace())
+            return false;
+
+        auto& parentEdges = parent->getParentEdges();
+        for (auto& edge : parentEdges) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            // the memory of the dynamic output may be not allocated yet, so it can't be traced back
+            if (defaultPtr && e->getMemory().GetData() == defaultPtr) {
+                parent = e->getParent();
+                break;
             }
-            if (canBeInPlace) {
-                for (auto& edge : childEdges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
+static std::vector<EdgePtr> getChildEdges(const NodePtr &node) {
+    std::vector<EdgePtr> edges;
+    for (auto& edge : node->getChildEdges()) {
+        auto e = edge.lock();
+        if (!e)
+            IE_THROW() << "Node " << node->getName() << " contains empty child edge";
+        edges.push_back(e);
+    }
+    return edges;
+}
 
+void InferRequestBase::changeDefaultPtr() {
+    for (auto& it : externalPtr) {
+        const auto& inputNodesMap = graph->GetInputNodesMap();
+        auto input = inputNodesMap.find(it.first);
+        if (input != inputNodesMap.end()) {
+            NodePtr inputNodePtr = input->second;
+            if (inputNodePtr->getChildEdgeAt(0)->getMemory().GetData() == it.second)
+                continue;
+            if (canBeInPlaceInput(inputNodePtr)) {
+                for (auto& e : getChildEdges(inputNodePtr))
                     changeEdgePtr(e, it.second);
-                }
             }
 
             continue;
@@ -277,31 +311,7 @@ void InferRequestBase::changeDefaultPtr() {
             if (parentEdge->getMemory().GetData() == it.second)
                 continue;
 
-            bool canBeInPlace = true;
-            void* defaultPtr = parentEdge->getMemory().GetData();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = parentEdge->getParent();
-            NodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& parentEdges = parent->getParentEdges();
-                for (auto& edge : parentEdges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
-
-                    if (e->getMemory().GetData() == defaultPtr) {
-                        parent = e->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
+            if (canBeInPlaceOutput(parentEdge))
                 changeEdgePtr(parentEdge, it.second);
             continue;
         }
@@ -309,6 +319,116 @@ void InferRequestBase::changeDefaultPtr() {
     }
 }
 
+void InferRequestBase::changeDynamicPtr() {
+    // The dynamic shape tensors are bound at every inference, since the user may replace the tensor memory
+    // together with the shape. The memory of the edges is reset when a tensor can't be bound anymore.
+    std::unordered_set<std::string> boundBlobs;
+
+    for (const auto& input : graph->GetInputNodesMap()) {
+        const auto& name = input.first;
+        const auto& inputNodePtr = input.second;
+        const auto blob = _inputs.find(name);
+        if (!inputNodePtr->isDynamicNode() || externalPtr.count(name) || blob == _inputs.end())
+            continue;
+
+        const auto& blobDesc = blob->second->getTensorDesc();
+        const auto& edgeMemory = inputNodePtr->getChildEdgeAt(0)->getMemory();
+        if (blobDesc.getLayout() != InferenceEngine::Layout::SCALAR && !blob->second->is<InferenceEngine::CompoundBlob>() &&
+            edgeMemory.getDesc().isDefined() &&
+            edgeMemory.getDesc().isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc)) &&
+            graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit &&
+            canBeInPlaceInput(inputNodePtr)) {
+            void* blobPtr = blob->second->buffer();
+            for (auto& e : getChildEdges(inputNodePtr))
+                changeEdgePtr(e, blobPtr);
+            boundBlobs.insert(name);
+        } else if (dynamicBoundBlobs.count(name)) {
+            resetEdgesPtr(getChildEdges(inputNodePtr));
+        }
+    }
+
+    for (const auto& output : graph->GetOutputNodesMap()) {
+        const auto& name = output.first;
+        const auto& outputNodePtr = output.second;
+        const auto blob = _outputs.find(name);
+        if (!outputNodePtr->isDynamicNode() || externalPtr.count(name) || blob == _outputs.end())
+            continue;
+
+        // the output shape is known after the inference only, so the memory is used while the output fits into the tensor
+        const auto& blobDesc = blob->second->getTensorDesc();
+        auto parentEdge = outputNodePtr->getParentEdgeAt(0);
+        const auto& edgeDesc = parentEdge->getMemory().getDesc();
+        const auto& order = blobDesc.getBlockingDesc().getOrder();
+        const bool isPlanarBlob = blobDesc.getLayout() != InferenceEngine::Layout::SCALAR &&
+                                  std::is_sorted(order.begin(), order.end()) &&
+                                  blobDesc.getDims().size() == edgeDesc.getShape().getRank();
+        const size_t blobSize = blob->second->byteSize();
+        if (isPlanarBlob && edgeDesc.hasLayoutType(LayoutType::ncsp) && edgeDesc.getPrecision() == blobDesc.getPrecision() &&
+            !graph->getProperty().batchLimit && blobSize != 0 &&
+            (!edgeDesc.isDefined() || edgeDesc.getCurrentMemSize() <= blobSize) &&
+            canBeInPlaceOutput(parentEdge)) {
+            parentEdge->getMemoryPtr()->setDataHandle(blob->second->buffer(), blobSize);
+            boundBlobs.insert(name);
+        } else if (dynamicBoundBlobs.count(name)) {
+            resetEdgesPtr({parentEdge});
+        }
+    }
+
+    dynamicBoundBlobs = std::move(boundBlobs);
+}
+
+void InferRequestBase::countIOCopies() {
+    auto count = [&](IOCopyReason reason) {
+        execNetwork->_ioCopyCounters[static_cast<size_t>(reason)]++;
+    };
+
+    for (const auto& input : _inputs) {
+        const auto inputNode = graph->GetInputNodesMap().find(input.first);
+        if (inputNode == graph->GetInputNodesMap().end() || input.second->is<InferenceEngine::CompoundBlob>())
+            continue;
+
+        const auto& blobDesc = input.second->getTensorDesc();
+        const auto& edgeMemory = inputNode->second->getChildEdgeAt(0)->getMemory();
+        if (edgeMemory.GetData() == input.second->cbuffer().as<const void*>()) {
+            count(IOCopyReason::ZeroCopy);
+        } else if (edgeMemory.getDesc().getPrecision() != blobDesc.getPrecision()) {
+            count(IOCopyReason::Precision);
+        } else if (graph->_normalizePreprocMap.find(input.first) != graph->_normalizePreprocMap.end()) {
+            count(IOCopyReason::Preprocessing);
+        } else if (graph->getProperty().batchLimit) {
+            count(IOCopyReason::DynamicBatch);
+        } else if (blobDesc.getLayout() == InferenceEngine::Layout::ANY ||
+                   !edgeMemory.getDesc().isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc))) {
+            count(IOCopyReason::Layout);
+        } else {
+            count(IOCopyReason::InPlace);
+        }
+    }
+
+    for (const auto& output : _outputs) {
+        const auto outputNode = graph->GetOutputNodesMap().find(output.first);
+        if (outputNode == graph->GetOutputNodesMap().end() || output.second->size() == 0)
+            continue;
+
+        const auto& blobDesc = output.second->getTensorDesc();
+        const auto& edgeMemory = outputNode->second->getParentEdgeAt(0)->getMemory();
+        if (edgeMemory.GetData() == output.second->buffer().as<void*>()) {
+            count(IOCopyReason::ZeroCopy);
+        } else if (edgeMemory.getDesc().getPrecision() != blobDesc.getPrecision()) {
+            count(IOCopyReason::Precision);
+        } else if (graph->getProperty().batchLimit) {
+            count(IOCopyReason::DynamicBatch);
+        } else if (blobDesc.getLayout() == InferenceEngine::Layout::ANY ||
+                   MemoryDescUtils::convertToTensorDesc(edgeMemory.getDesc()).getBlockingDesc() != blobDesc.getBlockingDesc()) {
+            count(IOCopyReason::Layout);
+        } else if (dynamicBoundBlobs.count(output.first)) {
+            count(IOCopyReason::Capacity);
+        } else {
+            count(IOCopyReason::InPlace);
+        }
+    }
+}
+
 std::vector<InferenceEngine::IVariableStateInternal::Ptr> InferRequestBase::QueryState() {
     return memoryStates;
 }
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_set>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace ov {
@@ -64,6 +65,11 @@ private:
     void redefineMemoryForInputNodes();
 
     void changeDefaultPtr();
+    void changeDynamicPtr();
+    void countIOCopies();
+
+    // dynamic shape inputs and outputs bound to the user memory at the last inference
+    std::unordered_set<std::string>     dynamicBoundBlobs;
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
@@ -4,17 +4,20 @@
 
 #include "convert_matmul_to_fc.hpp"
 #include "op/fully_connected.hpp"
+#include "fc_weights_decompression.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 
 #include "itt.hpp"
 
 ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
     MATCHER_SCOPE(ConvertMatMulToFC);
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    // the weights are either a Constant or the decompression subgraph of the compressed weights
+    auto weights_m = ngraph::pattern::any_input();
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -30,6 +33,11 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         auto fc_input_a = pattern_map.at(activations_m);
         auto fc_input_b = pattern_map.at(weights_m);
 
+        const auto decompression_nodes = get_weights_decompression_nodes(fc_input_b);
+        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) && decompression_nodes.empty()) {
+            return false;
+        }
+
         auto shape_a = fc_input_a.get_partial_shape();
         auto shape_b = fc_input_b.get_partial_shape();
         NGRAPH_CHECK(shape_b.is_static());
@@ -43,10 +51,9 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
             return false;
         }
 
-        // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
+        // Check that if second inputs shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
-            std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
+        if (std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
         /*
@@ -118,6 +125,48 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
             return transpose;
         };
 
+        /*
+         *  transpose_decompression function moves the weights transposition to the constant inputs of the decompression
+         *  subgraph, so the compressed weights stay unfolded. The scalar constants are kept as is, other constants must have
+         *  the weights rank. Returns nullptr if the subgraph can't be transposed this way (e.g. the groups Reshape is present).
+         */
+
+        auto transpose_decompression = [&](ngraph::NodeVector& new_ops) -> std::shared_ptr<ngraph::Node> {
+            std::shared_ptr<ngraph::Node> prev_node, new_prev_node;
+            ngraph::NodeVector transposed;
+            for (auto it = decompression_nodes.rbegin(); it != decompression_nodes.rend(); ++it) {
+                const auto& node = *it;
+                if (ov::is_type<ngraph::opset1::Reshape>(node))
+                    return nullptr;
+
+                ngraph::OutputVector new_inputs;
+                for (const auto& input : node->input_values()) {
+                    if (prev_node && input.get_node_shared_ptr() == prev_node) {
+                        new_inputs.push_back(new_prev_node);
+                    } else if (ngraph::shape_size(input.get_shape()) == 1) {
+                        new_inputs.push_back(input);
+                    } else if (input.get_shape().size() == static_cast<size_t>(rank_b)) {
+                        auto transpose = create_transpose(input, input.get_node()->get_friendly_name() + "/transpose_b");
+                        transposed.push_back(transpose);
+                        new_inputs.push_back(transpose);
+                    } else {
+                        return nullptr;
+                    }
+                }
+
+                auto new_node = node->clone_with_new_inputs(new_inputs);
+                new_node->set_friendly_name(node->get_friendly_name());
+                ngraph::copy_runtime_info(node, new_node);
+                if (ov::is_type<ngraph::opset1::Convert>(new_node))
+                    ov::disable_constant_folding(new_node);
+                transposed.push_back(new_node);
+                prev_node = node;
+                new_prev_node = new_node;
+            }
+            new_ops.insert(new_ops.end(), transposed.begin(), transposed.end());
+            return new_prev_node;
+        };
+
         ngraph::NodeVector new_ops;
         bool success = true;
         ngraph::PartialShape shape_a_aligned, shape_b_aligned;
@@ -136,8 +185,13 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Weights normalization
         if (!matmul->get_transpose_b()) {
-            fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
-            new_ops.push_back(fc_input_b.get_node_shared_ptr());
+            std::shared_ptr<ngraph::Node> transposed_b = decompression_nodes.empty() ? nullptr : transpose_decompression(new_ops);
+            if (transposed_b) {
+                fc_input_b = transposed_b;
+            } else {
+                fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
+                new_ops.push_back(fc_input_b.get_node_shared_ptr());
+            }
         }
 
         if (rank_b != 2) {
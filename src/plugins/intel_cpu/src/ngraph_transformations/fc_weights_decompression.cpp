@@ -0,0 +1,240 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_weights_decompression.hpp"
+#include "op/fully_connected.hpp"
+#include "op/power_static.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+#include <utils/general_utils.h>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <algorithm>
+
+#include "itt.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+bool has_only_child(const std::shared_ptr<const ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+// the scales and the zero points are constants, possibly not folded from the lower precision yet
+bool is_decompression_constant(const ngraph::Output<ngraph::Node>& input) {
+    auto node = input.get_node_shared_ptr();
+    if (ov::is_type<ngraph::opset1::Convert>(node))
+        node = node->get_input_node_shared_ptr(0);
+    return ov::is_type<ngraph::opset1::Constant>(node) && input.get_partial_shape().is_static();
+}
+
+bool is_compressed_weights(const std::shared_ptr<const ngraph::Node>& node) {
+    return ov::is_type<ngraph::opset1::Constant>(node) &&
+           one_of(node->get_output_element_type(0), ngraph::element::u8, ngraph::element::i8,
+                                                    ngraph::element::u4, ngraph::element::i4);
+}
+
+// the kernel streams the weights once per block of 4 rows, so only the small inputs are computed by it
+constexpr size_t decompression_kernel_max_rows = 8;
+
+// the minimal number of the rows of the matrix multiplication source, the dynamic dimensions may be empty
+size_t get_min_rows(const ngraph::PartialShape& shape, bool transposed) {
+    const size_t rank = shape.rank().get_length();
+    const size_t k_axis = transposed && rank > 1 ? rank - 2 : rank - 1;
+    size_t rows = 1;
+    for (size_t i = 0; i < rank; i++) {
+        if (i != k_axis)
+            rows *= shape[i].get_min_length();
+    }
+    return rows;
+}
+
+std::shared_ptr<ngraph::Node> get_only_child(const std::shared_ptr<ngraph::Node>& node) {
+    if (!has_only_child(node))
+        return nullptr;
+    return node->get_output_target_inputs(0).begin()->get_node()->shared_from_this();
+}
+
+// checks whether the elementwise chain starting from the node produces the weights of MatMul or FullyConnected
+bool is_matmul_weights_subgraph(std::shared_ptr<ngraph::Node> node) {
+    while (has_only_child(node)) {
+        const auto input = *node->get_output_target_inputs(0).begin();
+        const auto child = input.get_node()->shared_from_this();
+        if (ov::is_type<ngraph::opset1::MatMul>(child) || ov::is_type<FullyConnectedNode>(child))
+            return input.get_index() == 1;
+        if (!ov::is_type<ngraph::opset1::Subtract>(child) && !ov::is_type<ngraph::opset1::Multiply>(child) &&
+            !ov::is_type<PowerStaticNode>(child) && !ov::is_type<ngraph::opset1::Reshape>(child) &&
+            !ov::is_type<ngraph::opset1::Transpose>(child))
+            return false;
+        node = child;
+    }
+    return false;
+}
+
+// Mirrors the checks of GraphOptimizer::FuseFCAndWeightsDecompression on the subgraph produced by ConvertMatMulToFC:
+// Convert -> [Subtract or PowerStatic] -> Multiply or PowerStatic -> [Reshape] -> FullyConnected (weights)
+bool is_fusable_decompression(const std::shared_ptr<ngraph::Node>& convert) {
+    if (!one_of(convert->get_input_element_type(0), ngraph::element::u8, ngraph::element::i8) ||
+        convert->get_output_element_type(0) != ngraph::element::f32 || !has_only_child(convert->get_input_node_shared_ptr(0)))
+        return false;
+
+    auto is_f32_constant = [](const ngraph::Output<ngraph::Node>& input) {
+        return ov::is_type<ngraph::opset1::Constant>(input.get_node()) && input.get_element_type() == ngraph::element::f32;
+    };
+
+    std::vector<std::shared_ptr<ngraph::Node>> constants;
+    auto node = get_only_child(convert);
+    if (!node)
+        return false;
+    if (ov::is_type<ngraph::opset1::Subtract>(node)) {
+        if (!is_f32_constant(node->input_value(1)))
+            return false;
+        constants.push_back(node->get_input_node_shared_ptr(1));
+        node = get_only_child(node);
+    } else if (const auto power = ov::as_type_ptr<PowerStaticNode>(node)) {
+        // the scalar zero point
+        if (power->get_power() == 1.f && power->get_scale() == 1.f)
+            node = get_only_child(node);
+    }
+
+    if (const auto multiply = ov::as_type_ptr<ngraph::opset1::Multiply>(node)) {
+        const size_t scales_port = is_f32_constant(multiply->input_value(1)) ? 1 : 0;
+        if (!is_f32_constant(multiply->input_value(scales_port)))
+            return false;
+        constants.push_back(multiply->get_input_node_shared_ptr(scales_port));
+    } else if (const auto power = ov::as_type_ptr<PowerStaticNode>(node)) {
+        if (power->get_power() != 1.f || power->get_shift() != 0.f)
+            return false;
+    } else {
+        return false;
+    }
+    node = get_only_child(node);
+
+    if (ov::is_type<ngraph::opset1::Reshape>(node))
+        node = get_only_child(node);
+    const auto fc = ov::as_type_ptr<FullyConnectedNode>(node);
+    if (!fc || fc->get_input_partial_shape(0).rank().is_dynamic() || fc->get_input_partial_shape(0).size() > 3 ||
+        fc->get_input_partial_shape(1).size() != 2 ||
+        !is_decompression_kernel_applicable(get_min_rows(fc->get_input_partial_shape(0), false)))
+        return false;
+
+    // the decompression is done in the [OC, G, IC / G] layout, the leading unit dimensions are skipped
+    const auto& fc_weights_shape = fc->get_input_shape(1);
+    const size_t OC = fc_weights_shape[0];
+    const size_t IC = fc_weights_shape[1];
+    const auto& chain_shape = convert->get_output_shape(0);
+    size_t skipped = 0;
+    while (chain_shape.size() - skipped > 2 && chain_shape[skipped] == 1)
+        skipped++;
+    const size_t rank = chain_shape.size() - skipped;
+    const size_t G = rank == 3 ? chain_shape[skipped + 1] : 1;
+    if (rank > 3 || chain_shape[skipped] != OC || chain_shape.back() * G != IC)
+        return false;
+
+    // the scales and the zero points are per output channel and group
+    for (const auto& constant : constants) {
+        auto shape = constant->get_output_shape(0);
+        if (shape.size() > chain_shape.size())
+            return false;
+        shape.insert(shape.begin(), chain_shape.size() - shape.size(), 1);
+        if (std::any_of(shape.begin(), shape.begin() + skipped, [](size_t dim) { return dim != 1; }))
+            return false;
+        const size_t const_OC = shape[skipped];
+        const size_t const_G = rank == 3 ? shape[skipped + 1] : 1;
+        if (shape.back() != 1 || (const_OC != 1 && const_OC != OC) || (const_G != 1 && const_G != G))
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+bool is_decompression_kernel_applicable(size_t rows) {
+    return dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2) && rows <= decompression_kernel_max_rows;
+}
+
+ngraph::NodeVector get_weights_decompression_nodes(const ngraph::Output<ngraph::Node>& weights) {
+    ngraph::NodeVector nodes;
+    auto node = weights.get_node_shared_ptr();
+
+    if (ov::is_type<ngraph::opset1::Reshape>(node)) {
+        if (!has_only_child(node) || !ov::is_type<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1)))
+            return {};
+        nodes.push_back(node);
+        node = node->get_input_node_shared_ptr(0);
+    }
+
+    if (!ov::is_type<ngraph::opset1::Multiply>(node) || !has_only_child(node))
+        return {};
+    nodes.push_back(node);
+    // the scales may be on any of the Multiply inputs
+    const size_t scalesPort = is_decompression_constant(node->input_value(1)) ? 1 : 0;
+    if (!is_decompression_constant(node->input_value(scalesPort)))
+        return {};
+    node = node->get_input_node_shared_ptr(1 - scalesPort);
+
+    if (ov::is_type<ngraph::opset1::Subtract>(node)) {
+        if (!has_only_child(node) || !is_decompression_constant(node->input_value(1)))
+            return {};
+        nodes.push_back(node);
+        node = node->get_input_node_shared_ptr(0);
+    }
+
+    if (!ov::is_type<ngraph::opset1::Convert>(node) || !has_only_child(node) ||
+        !node->get_output_element_type(0).is_real() || !is_compressed_weights(node->get_input_node_shared_ptr(0)) ||
+        !has_only_child(node->get_input_node_shared_ptr(0)))
+        return {};
+    nodes.push_back(node);
+
+    return nodes;
+}
+
+bool is_compressed_weights_convert(const std::shared_ptr<const ngraph::Node>& node) {
+    return ov::is_type<ngraph::opset1::Convert>(node) && is_compressed_weights(node->get_input_node_shared_ptr(0)) &&
+           ov::pass::constant_folding_is_disabled(node.get());
+}
+
+MarkFCWeightsDecompression::MarkFCWeightsDecompression() {
+    MATCHER_SCOPE(MarkFCWeightsDecompression);
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ngraph::pattern::any_input(),
+                                                                        ngraph::pattern::any_input()});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto matmul = ov::as_type_ptr<ngraph::opset1::MatMul>(m.get_match_root());
+        if (!matmul || matmul->get_input_partial_shape(0).rank().is_dynamic() ||
+            !is_decompression_kernel_applicable(get_min_rows(matmul->get_input_partial_shape(0), matmul->get_transpose_a())))
+            return false;
+        const auto nodes = get_weights_decompression_nodes(matmul->input_value(1));
+        if (nodes.empty() || ov::pass::constant_folding_is_disabled(nodes.back()))
+            return false;
+
+        // Subtract and Multiply are not folded since their input is not a constant anymore
+        ov::disable_constant_folding(nodes.back());
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, matcher_name);
+    this->register_matcher(m, callback);
+}
+
+FoldUnfusedFCWeightsDecompression::FoldUnfusedFCWeightsDecompression() {
+    MATCHER_SCOPE(FoldUnfusedFCWeightsDecompression);
+    auto convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({ngraph::pattern::wrap_type<ngraph::opset1::Constant>()});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto convert = m.get_match_root();
+        if (!is_compressed_weights_convert(convert) || !is_matmul_weights_subgraph(convert) ||
+            is_fusable_decompression(convert))
+            return false;
+
+        ov::enable_constant_folding(convert);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(convert_m, matcher_name);
+    this->register_matcher(m, callback);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Returns the nodes of the compressed weights decompression subgraph which produces the given MatMul weights:
+ *        Constant (u8/i8/u4/i4) -> Convert -> [Subtract (zero points)] -> Multiply (scales) -> [Reshape (groups)]
+ * The nodes are ordered from the subgraph output to the Convert, the result is empty if the weights are not compressed.
+ */
+ngraph::NodeVector get_weights_decompression_nodes(const ngraph::Output<ngraph::Node>& weights);
+
+/**
+ * @brief Checks whether the node is the Convert of the compressed integer weights marked by MarkFCWeightsDecompression
+ */
+bool is_compressed_weights_convert(const std::shared_ptr<const ngraph::Node>& node);
+
+/**
+ * @brief Checks whether FullyConnected with the compressed weights is computed by the decompression kernel for the
+ * given number of the source rows. The kernel streams the weights once per a few rows, so it is used for the small
+ * inputs only and requires avx2. The decompression is fused only if the kernel is used for the minimal input shape.
+ */
+bool is_decompression_kernel_applicable(size_t rows);
+
+/**
+ * @interface MarkFCWeightsDecompression
+ * @brief Disables the constant folding of the compressed MatMul weights, so the decompression subgraph is kept
+ * until the plugin fuses it into FullyConnected and the weights are stored in the compressed precision.
+ * Only MatMuls which may use the decompression kernel are marked.
+ */
+class MarkFCWeightsDecompression : public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkFCWeightsDecompression", "0");
+    MarkFCWeightsDecompression();
+};
+
+/**
+ * @interface FoldUnfusedFCWeightsDecompression
+ * @brief Enables the constant folding of the compressed weights marked by MarkFCWeightsDecompression back if the
+ * plugin can't fuse their decompression into FullyConnected (e.g. the subgraph was transformed to an unsupported form).
+ * Otherwise the compressed weights and the FP32 results of the decompression constant nodes would both be kept.
+ */
+class FoldUnfusedFCWeightsDecompression : public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FoldUnfusedFCWeightsDecompression", "0");
+    FoldUnfusedFCWeightsDecompression();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include "snippets_mark_skipped.hpp"
+#include "fc_weights_decompression.hpp"
 #include "snippets/pass/collapse_subgraph.hpp"
 #include "snippets/op/subgraph.hpp"
 #include "snippets/utils.hpp"
@@ -158,6 +159,15 @@ int getChannelAxis(const ov::AxisSet &axes, bool keep_dims) {
     }
     return channelAxis;
 }
+// Softmax fuses the consumers only in the JIT implementation along the innermost axis
+bool isSuitableSoftmaxParent(const std::shared_ptr<const Node> &node) {
+    const auto softmax = ov::as_type_ptr<const ngraph::op::v1::Softmax>(node);
+    if (!softmax)
+        return false;
+    const auto rank = softmax->get_input_partial_shape(0).rank();
+    return rank.is_static() && rank.get_length() >= 3 &&
+           softmax->get_axis() == static_cast<size_t>(rank.get_length() - 1);
+}
 bool isSuitableMiscParent(const std::shared_ptr<const Node> &node) {
     const bool is_suitable_node = ov::is_type<ngraph::op::v0::MVN>(node) ||
                                   ov::is_type<ngraph::op::v6::MVN>(node) ||
@@ -169,7 +179,8 @@ bool isSuitableMiscParent(const std::shared_ptr<const Node> &node) {
                                   ov::is_type<ngraph::opset1::ConvolutionBackpropData>(node) ||
                                   ov::is_type<ngraph::op::util::ArithmeticReductionKeepDims>(node) ||
                                   ov::is_type<ngraph::opset1::GroupConvolutionBackpropData>(node) ||
-                                  ov::is_type<ngraph::opset1::AvgPool>(node);
+                                  ov::is_type<ngraph::opset1::AvgPool>(node) ||
+                                  isSuitableSoftmaxParent(node);
     // has a single output, connected to a single child
     const auto out = node->outputs();
     const bool has_only_child = (out.size() == 1) && (out[0].get_target_inputs().size() == 1);
@@ -424,6 +435,12 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
         if (ngraph::op::is_constant(node))
             continue;
 
+        if (ov::is_type<ngraph::op::v0::MatMul>(node)) {
+            // the decompression subgraph of the compressed weights is fused into FullyConnected on the plugin side
+            for (const auto& decompressionNode : get_weights_decompression_nodes(node->input_value(1)))
+                SetSnippetsNodeType(decompressionNode, snippets::pass::SnippetsNodeType::SkippedByPlugin);
+        }
+
         if (ngraph::op::is_parameter(node)) {
             SetNodeFusingType(node, NodeFusingType::IgnoredAfterInputs);
         } else if (isSuitableConvolutionParent(node)) {
@@ -10,6 +10,8 @@
 #include "caseless.hpp"
 #include <vector>
 #include <string>
+#include <sstream>
+#include <iomanip>
 #include <limits>
 #include <cstdint>
 #include <unordered_map>
@@ -53,6 +55,7 @@
 
 #include <dnnl_types.h>
 #include <dnnl_debug.h>
+#include <common/primitive_hashing_utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
@@ -60,6 +63,7 @@
 #include "nodes/common/cpu_convert.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "openvino/util/data_hash.hpp"
 
 using namespace dnnl;
 using namespace openvino;
@@ -70,6 +74,100 @@ using namespace InferenceEngine::details;
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+/**
+ * Serializes the operation attributes. Any attribute of the type which isn't handled explicitly
+ * (bodies, opaque structures) makes the operation not identifiable.
+ */
+class OpAttributesSerializer : public ov::AttributeVisitor {
+public:
+    OpAttributesSerializer() {
+        // the floating point values are printed with the precision enough to restore them exactly
+        stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        identifiable = false;
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        append(name, adapter.get());
+    }
+
+    std::string str() const {
+        return stream.str();
+    }
+
+    bool identifiable = true;
+
+private:
+    template <typename T>
+    void append(const std::string& name, const T& value) {
+        stream << name << '=';
+        write(value);
+        stream << ';';
+    }
+
+    template <typename T>
+    void append(const std::string& name, const std::vector<T>& values) {
+        stream << name << "=[";
+        for (const auto& value : values)
+            write(value);
+        stream << "];";
+    }
+
+    template <typename T>
+    void write(const T& value) {
+        stream << value << ',';
+    }
+
+    // the strings are prefixed by the length, so the separators inside them can't be confused with the structure
+    void write(const std::string& value) {
+        stream << value.size() << ':' << value << ',';
+    }
+
+    std::ostringstream stream;
+};
+
+std::string computeOpSignature(const std::shared_ptr<ngraph::Node>& op) {
+    const auto& typeInfo = op->get_type_info();
+    std::string signature = std::string(typeInfo.name) + "." + (typeInfo.version_id ? typeInfo.version_id : "");
+
+    // the constants are identified by the content of their memory, see Graph::ExecuteConstantNodesOnly
+    if (ov::is_type<ov::op::v0::Constant>(op))
+        return signature;
+
+    OpAttributesSerializer serializer;
+    if (!op->visit_attributes(serializer) || !serializer.identifiable)
+        return {};
+
+    return signature + "{" + serializer.str() + "}";
+}
+}   // namespace
+
 Node::NodesFactory & Node::factory() {
     static NodesFactory factoryInstance;
     return factoryInstance;
@@ -173,6 +271,13 @@ Node::Node(const std::string& type, const std::string& name, const dnnl::engine&
           weightCache(w_cache), engine(eng), fusingPort(-1), name(name), typeStr(type),
           type(TypeFromName(type)), profiling(name) {
     // TODO [NM]: What about filling inDims and outDims?
+    // the semantics of the internally created reorders and converts are defined by their memory descriptors only
+    if (one_of(this->type, Type::Reorder, Type::Convert))
+        opSignature = typeStr;
+}
+
+void Node::initOpSignature(const std::shared_ptr<ngraph::Node>& op) {
+    opSignature = computeOpSignature(op);
 }
 
 void Node::addEdge(const EdgeWeakPtr& edge) {
@@ -1477,8 +1582,75 @@ std::vector<VectorDims> Node::shapeInfer() const {
     return shapeInferGeneric();
 }
 
+size_t Node::ShapeInferKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& dims : inputDims) {
+        seed = get_vector_hash(seed, dims);
+    }
+    seed = hash_combine(seed, valuePortMask);
+    if (!inputValues.empty()) {
+        seed = hash_combine(seed, ov::util::hash_data(inputValues.data(), inputValues.size()));
+    }
+    return seed;
+}
+
+bool Node::ShapeInferKey::operator==(const ShapeInferKey& rhs) const {
+    return valuePortMask == rhs.valuePortMask && inputDims == rhs.inputDims && inputValues == rhs.inputValues;
+}
+
+CacheEntryBase::Statistics Node::getShapeInferCacheStatistics() const {
+    CacheEntryBase::Statistics result;
+    result.hits = shapeInferCacheHits.load(std::memory_order_relaxed);
+    result.misses = shapeInferCacheMisses.load(std::memory_order_relaxed);
+    result.evictions = shapeInferCacheEvictions.load(std::memory_order_relaxed);
+    return result;
+}
+
 std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<StaticShape>& input_shapes,
                                                 uint32_t input_value_port_mask) const {
+    // the values of the data dependent ports are a part of the key, so only the small ones are worth caching
+    constexpr size_t maxCachedValuesSize = 4096;
+    constexpr size_t shapeInferCacheCapacity = 64;
+
+    ShapeInferKey key;
+    bool useCache = true;
+    key.valuePortMask = input_value_port_mask;
+    key.inputDims.reserve(input_shapes.size());
+    for (const auto& shape : input_shapes) {
+        key.inputDims.push_back(shape.to_shape());
+    }
+    if (input_value_port_mask) {
+        const auto & iranks = shapeInference->get_input_ranks();
+        for (size_t port = 0; port < iranks.size(); port++) {
+            if (input_value_port_mask & (1 << port)) {
+                const auto& mem = getParentEdgesAtPort(port)[0]->getMemory();
+                const size_t size = mem.GetSize();
+                if (key.inputValues.size() + size > maxCachedValuesSize) {
+                    useCache = false;
+                    break;
+                }
+                const auto* data = static_cast<const uint8_t*>(mem.GetPtr());
+                key.inputValues.insert(key.inputValues.end(), data, data + size);
+            }
+        }
+    }
+
+    if (useCache) {
+        if (!shapeInferCache) {
+            shapeInferCache.reset(new LruCache<ShapeInferKey, std::vector<VectorDims>>(shapeInferCacheCapacity));
+        }
+        // the shape inference always produces at least one output shape, so the empty value means a miss
+        auto cached = shapeInferCache->get(key);
+        if (!cached.empty()) {
+            shapeInferCacheHits.fetch_add(1, std::memory_order_relaxed);
+            return cached;
+        }
+        shapeInferCacheMisses.fetch_add(1, std::memory_order_relaxed);
+    }
+
     // collect input values
     std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>> input_values;
     if (input_value_port_mask) {
@@ -1510,6 +1682,11 @@ std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<StaticShape>&
         return s.to_shape();
     });
 
+    if (useCache && !result.empty()) {
+        shapeInferCache->put(key, result);
+        shapeInferCacheEvictions.store(shapeInferCache->getEvictionsCount(), std::memory_order_relaxed);
+    }
+
     return result;
 }
 
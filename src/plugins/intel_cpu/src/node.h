@@ -10,6 +10,7 @@
 #include <string>
 #include <cassert>
 #include <algorithm>
+#include <atomic>
 #include <caseless.hpp>
 #include "cpu_memory.h"
 #include "edge.h"
@@ -30,6 +31,7 @@
 #include "cpu_shape.h"
 #include "nodes/node_config.h"
 #include "cache/multi_cache.h"
+#include "cache/lru_cache.h"
 
 #include <utils/shape_inference/static_shape.hpp>
 #include <utils/shape_inference/shape_inference.hpp>
@@ -252,6 +254,21 @@ public:
         return originalLayers;
     }
 
+    /**
+     * @brief Returns the serialized type and attributes of the operation the node was created from.
+     * Empty string means the node semantics can't be identified by the signature (e.g. the operation has a body)
+     * or the signature wasn't initialized.
+     */
+    const std::string& getOpSignature() const {
+        return opSignature;
+    }
+
+    /**
+     * @brief Serializes the attributes of the operation the node was created from. Is called by the graph only
+     * when the constants cache is enabled, the serialization isn't free.
+     */
+    void initOpSignature(const std::shared_ptr<ngraph::Node>& op);
+
     Type getType() const {
         return type;
     }
@@ -327,6 +344,12 @@ public:
 
     PerfCount &PerfCounter() { return perfCounter; }
 
+    /**
+     * @brief Returns the hit/miss/eviction counters of the shape inference cache of the node
+     * @note may be called concurrently with the node execution
+     */
+    CacheEntryBase::Statistics getShapeInferCacheStatistics() const;
+
     virtual void setDynamicBatchLim(int lim);
 
     void resolveInPlaceEdges();
@@ -609,6 +632,7 @@ protected:
     bool enforceBF16evenForGraphTail = false;
 
     std::string originalLayers;  // contains names of the original layers separated by comma
+    std::string opSignature;
 
     Node(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &w_cache);
     Node(const std::string& type, const std::string& name, const dnnl::engine& eng, WeightsSharing::Ptr &w_cache);
@@ -751,6 +775,22 @@ protected:
 
     std::shared_ptr<IShapeInfer> shapeInference;
 
+    // Results of the generic shape inference memoized by the input shapes and the values of the data dependent ports.
+    // The dynamic models usually alternate a limited set of input shapes, so the repeated ones don't invoke
+    // the shape inference at all.
+    struct ShapeInferKey {
+        std::vector<VectorDims> inputDims;
+        std::vector<uint8_t> inputValues;
+        uint32_t valuePortMask;
+
+        size_t hash() const;
+        bool operator==(const ShapeInferKey& rhs) const;
+    };
+    mutable std::unique_ptr<LruCache<ShapeInferKey, std::vector<VectorDims>>> shapeInferCache;
+    mutable std::atomic<size_t> shapeInferCacheHits{0};
+    mutable std::atomic<size_t> shapeInferCacheMisses{0};
+    mutable std::atomic<size_t> shapeInferCacheEvictions{0};
+
     std::shared_ptr<std::mutex> sharedMutex = nullptr;
 
 private:
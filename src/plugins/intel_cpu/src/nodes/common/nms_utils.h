@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "ie_parallel.hpp"
+
+/**
+ * @brief Candidates selection helpers shared by the detection post processing nodes
+ * (NonMaxSuppression, MulticlassNms, DetectionOutput).
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+// (score, box index) pair
+using ScoredBox = std::pair<float, int>;
+
+/**
+ * @brief Orders the candidates by the descending score, the ties are resolved by the ascending box index,
+ * so the selection is deterministic.
+ */
+struct ScoreDescending {
+    bool operator()(const ScoredBox& l, const ScoredBox& r) const {
+        return l.first > r.first || (l.first == r.first && l.second < r.second);
+    }
+};
+
+/**
+ * @brief Collects the indices of the scores passing the threshold into the indices buffer.
+ * The compaction is branchless: with the random scores of the detectors the data dependent branch is mispredicted
+ * about every other box, while the unconditional store and the counter increment are not.
+ * @param scores scores of the n boxes
+ * @param inclusive whether the score equal to the threshold passes
+ * @param indices output buffer with room for n elements
+ * @return the number of the collected indices
+ */
+inline int filterByScore(const float* scores, int n, float threshold, bool inclusive, int* indices) {
+    int count = 0;
+    if (inclusive) {
+        for (int i = 0; i < n; i++) {
+            indices[count] = i;
+            count += static_cast<int>(scores[i] >= threshold);
+        }
+    } else {
+        for (int i = 0; i < n; i++) {
+            indices[count] = i;
+            count += static_cast<int>(scores[i] > threshold);
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief The same as above, but collects the (score, box index) pairs.
+ */
+inline void filterByScore(const float* scores, int n, float threshold, bool inclusive, std::vector<ScoredBox>& candidates) {
+    candidates.resize(n);
+    size_t count = 0;
+    if (inclusive) {
+        for (int i = 0; i < n; i++) {
+            candidates[count] = std::make_pair(scores[i], i);
+            count += static_cast<size_t>(scores[i] >= threshold);
+        }
+    } else {
+        for (int i = 0; i < n; i++) {
+            candidates[count] = std::make_pair(scores[i], i);
+            count += static_cast<size_t>(scores[i] > threshold);
+        }
+    }
+    candidates.resize(count);
+}
+
+/**
+ * @brief Yields the candidates in the ScoreDescending order without sorting all of them.
+ * The heap is built in O(n) and every next() costs O(log n), so the suppression loops, which stop as soon as
+ * max_output_boxes_per_class boxes are selected, pay only for the candidates they actually visit.
+ * The candidates vector is reordered in place and must outlive the object.
+ */
+class SortedCandidates {
+public:
+    explicit SortedCandidates(std::vector<ScoredBox>& candidates) : _candidates(candidates), _size(candidates.size()) {
+        std::make_heap(_candidates.begin(), _candidates.end(), heapCompare);
+    }
+
+    bool empty() const {
+        return _size == 0;
+    }
+
+    ScoredBox next() {
+        std::pop_heap(_candidates.begin(), _candidates.begin() + _size, heapCompare);
+        _size--;
+        return _candidates[_size];
+    }
+
+private:
+    // the heap top is the greatest element, i.e. the first one in the ScoreDescending order
+    static bool heapCompare(const ScoredBox& l, const ScoredBox& r) {
+        return ScoreDescending()(r, l);
+    }
+
+    std::vector<ScoredBox>& _candidates;
+    size_t _size;
+};
+
+/**
+ * @brief Sorts at least the first k candidates in the ScoreDescending order, the rest may be left in an unspecified
+ * order. The single threaded partial sort pays off only when k is much smaller than the number of the candidates,
+ * otherwise all the candidates are sorted by parallel_sort.
+ */
+inline void partialSortByScore(std::vector<ScoredBox>& candidates, size_t k) {
+    constexpr size_t minPartialSortRatio = 8;
+    if (k <= candidates.size() / minPartialSortRatio) {
+        std::partial_sort(candidates.begin(), candidates.begin() + k, candidates.end(), ScoreDescending());
+    } else {
+        InferenceEngine::parallel_sort(candidates.begin(), candidates.end(), ScoreDescending());
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
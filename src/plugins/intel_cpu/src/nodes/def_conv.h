@@ -119,15 +119,15 @@ private:
             virtual ~DefConvExecutor() = default;
 
         protected:
-            void prepareSamplingWeights(const float* offsets, const float* modulation = nullptr, bool enforceRef = false);
+            // The sampling buffers are passed by the caller, so one executor may be used by several streams at once
+            void prepareSamplingWeights(const float* offsets, const float* modulation,
+                                        int* pSampledCoordsVector, float* pInterpWeightsVector, bool enforceRef);
             jit_def_conv_params jcp = {};
             VectorDims srcStrides;
             VectorDims offStrides;
             VectorDims weiStrides;
             VectorDims modStrides;
             VectorDims dstStrides;
-            int *pSampledCoordsVector;
-            float *pInterpWeightsVector;
     };
 
     class DefConvRefExecutor : public DefConvExecutor {
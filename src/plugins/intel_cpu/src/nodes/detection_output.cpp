@@ -10,6 +10,7 @@
 #include <ngraph/op/detection_output.hpp>
 #include "ie_parallel.hpp"
 #include "detection_output.h"
+#include "common/nms_utils.h"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -393,13 +394,7 @@ inline void DetectionOutput::confFilterCF(float* reorderedConfData, int* indices
         int *pindices = indicesData + off;
         int *pbuffer = indicesBufData + off;
 
-        int count = 0;
-        for (int i = 0; i < numPriorsActual[n]; ++i) {
-            if (pconf[i] > confidenceThreshold) {
-                pindices[count] = i;
-                count++;
-            }
-        }
+        int count = filterByScore(pconf, numPriorsActual[n], confidenceThreshold, false, pindices);
 
         // in:  pindices count
         // out: buffer detectionCount
@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <dnnl_types.h>
@@ -10,13 +12,227 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "emitters/jit_load_store_emitters.hpp"
+#include "cache/multi_cache.h"
+#include <common/primitive_hashing_utils.hpp>
+
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
+using namespace dnnl::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
 
 namespace ov {
 namespace intel_cpu {
 namespace node {
 
+// Sums the table rows referenced by a single bag. The row is processed by blocks of several vectors which are
+// accumulated in registers over all the bag indices, the rows of the upcoming indices are prefetched meanwhile.
+template <cpu_isa_t isa>
+struct jit_uni_emb_bag_sum_kernel_f32 : public jit_uni_emb_bag_sum_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_bag_sum_kernel_f32)
+
+    explicit jit_uni_emb_bag_sum_kernel_f32(jit_emb_bag_config_params jcp) : jit_uni_emb_bag_sum_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        const size_t vectors_num = jcp_.emb_depth / vector_step;
+        const size_t tail_step = jcp_.emb_depth % vector_step;
+
+        load_vector_emitter.reset(new jit_load_emitter(this, isa, jcp_.prc, Precision::FP32, vector_step));
+        store_vector_emitter.reset(new jit_store_emitter(this, isa, Precision::FP32, jcp_.prc, vector_step));
+        if (tail_step != 0) {
+            load_tail_emitter.reset(new jit_load_emitter(this, isa, jcp_.prc, Precision::FP32, tail_step));
+            store_tail_emitter.reset(new jit_store_emitter(this, isa, Precision::FP32, jcp_.prc, tail_step));
+        }
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_indices_num, ptr[reg_params + GET_OFF(indices_num)]);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_weight.getIdx()), static_cast<size_t>(vmm_aux.getIdx())};
+
+        for (size_t v = 0; v < vectors_num; v += unroll_factor) {
+            worker_block(v, std::min(unroll_factor, vectors_num - v), false);
+        }
+        if (tail_step != 0) {
+            worker_block(vectors_num, 1, true);
+        }
+
+        this->postamble();
+
+        load_vector_emitter->emit_data();
+        store_vector_emitter->emit_data();
+        if (tail_step != 0) {
+            load_tail_emitter->emit_data();
+            store_tail_emitter->emit_data();
+        }
+    }
+
+private:
+    using Vmm = typename conditional3<isa == sse41, Xbyak::Xmm, isa == avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const size_t vector_step = vlen / sizeof(float);
+    const size_t unroll_factor = 4;
+    // the distance in indices for the row prefetching
+    const int prefetch_distance = 8;
+    const int cache_line_size = 64;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_indices = r10;
+    Xbyak::Reg64 reg_weights = r11;
+    Xbyak::Reg64 reg_indices_num = r12;
+    Xbyak::Reg64 reg_indices_aux = r13;
+    Xbyak::Reg64 reg_weights_aux = r14;
+    Xbyak::Reg64 reg_work_amount = rbx;
+    Xbyak::Reg64 reg_row = rsi;
+    Xbyak::Reg64 reg_prefetch_row = rdx;
+    Xbyak::Reg64 reg_tmp = rax;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_store_mask = rbp;
+
+    // Vmm(0..3) are the accumulators, Vmm(4..7) are the loaded values
+    Vmm vmm_weight = Vmm(8);
+    Vmm vmm_aux = Vmm(9);
+
+    std::unique_ptr<jit_load_emitter> load_vector_emitter = nullptr;
+    std::unique_ptr<jit_load_emitter> load_tail_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_vector_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_tail_emitter = nullptr;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    inline Vmm get_acc_vmm(size_t i) {
+        return Vmm(i);
+    }
+
+    inline Vmm get_val_vmm(size_t i) {
+        return Vmm(unroll_factor + i);
+    }
+
+    inline void load_weight() {
+        if (jcp_.prc == Precision::BF16) {
+            movzx(reg_tmp.cvt32(), word[reg_weights_aux]);
+            shl(reg_tmp.cvt32(), 16);
+            uni_vmovd(Xmm(vmm_weight.getIdx()), reg_tmp.cvt32());
+            uni_vbroadcastss(vmm_weight, Xmm(vmm_weight.getIdx()));
+        } else {
+            uni_vbroadcastss(vmm_weight, ptr[reg_weights_aux]);
+        }
+    }
+
+    inline void row_address(const Xbyak::Reg64 &reg_dst_row, int index_offset) {
+        movsxd(reg_dst_row, dword[reg_indices_aux + index_offset * sizeof(int)]);
+        imul(reg_dst_row, reg_dst_row, static_cast<int>(jcp_.emb_depth * jcp_.prc.size()));
+        add(reg_dst_row, reg_src);
+    }
+
+    // accumulates the vectors [first_vector, first_vector + vectors_num) of all the bag rows
+    inline void worker_block(size_t first_vector, size_t vectors_num, bool is_tail) {
+        const auto& load_emitter = is_tail ? load_tail_emitter : load_vector_emitter;
+        const auto& store_emitter = is_tail ? store_tail_emitter : store_vector_emitter;
+        const int block_offset = static_cast<int>(first_vector * vector_step * jcp_.prc.size());
+        const int block_size = static_cast<int>(vectors_num * vector_step * jcp_.prc.size());
+
+        for (size_t i = 0; i < vectors_num; i++)
+            uni_vpxor(get_acc_vmm(i), get_acc_vmm(i), get_acc_vmm(i));
+
+        mov(reg_indices_aux, reg_indices);
+        mov(reg_weights_aux, reg_weights);
+        mov(reg_work_amount, reg_indices_num);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        L(loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            Xbyak::Label prefetch_end_label;
+            cmp(reg_work_amount, prefetch_distance);
+            jle(prefetch_end_label, T_NEAR);
+            row_address(reg_prefetch_row, prefetch_distance);
+            for (int offset = 0; offset < block_size; offset += cache_line_size)
+                prefetcht0(ptr[reg_prefetch_row + block_offset + offset]);
+            L(prefetch_end_label);
+
+            row_address(reg_row, 0);
+            if (jcp_.with_weights)
+                load_weight();
+
+            for (size_t i = 0; i < vectors_num; i++) {
+                const int offset = block_offset + static_cast<int>(i * vector_step * jcp_.prc.size());
+                load_emitter->emit_code({static_cast<size_t>(reg_row.getIdx()), static_cast<size_t>(offset)},
+                                        {static_cast<size_t>(get_val_vmm(i).getIdx())}, {}, {load_pool_gpr_idxs});
+                if (jcp_.with_weights)
+                    uni_vfmadd231ps(get_acc_vmm(i), get_val_vmm(i), vmm_weight);
+                else
+                    uni_vaddps(get_acc_vmm(i), get_acc_vmm(i), get_val_vmm(i));
+            }
+
+            add(reg_indices_aux, static_cast<int>(sizeof(int)));
+            if (jcp_.with_weights)
+                add(reg_weights_aux, static_cast<int>(jcp_.prc.size()));
+            sub(reg_work_amount, 1);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        for (size_t i = 0; i < vectors_num; i++) {
+            const int offset = block_offset + static_cast<int>(i * vector_step * jcp_.prc.size());
+            store_emitter->emit_code({static_cast<size_t>(get_acc_vmm(i).getIdx()), static_cast<size_t>(offset)},
+                                     {static_cast<size_t>(reg_dst.getIdx())}, {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+        }
+    }
+};
+
+namespace {
+struct EmbBagSumKey {
+    jit_emb_bag_config_params jcp;
+
+    size_t hash() const;
+    bool operator==(const EmbBagSumKey& rhs) const;
+};
+
+size_t EmbBagSumKey::hash() const {
+    using namespace dnnl::impl;
+
+    size_t seed = 0;
+
+    seed = hash_combine(seed, jcp.prc.getPrecVal());
+    seed = hash_combine(seed, jcp.emb_depth);
+    seed = hash_combine(seed, jcp.with_weights);
+    return seed;
+}
+
+bool EmbBagSumKey::operator==(const EmbBagSumKey& rhs) const {
+    return jcp.prc == rhs.jcp.prc &&
+           jcp.emb_depth == rhs.jcp.emb_depth &&
+           jcp.with_weights == rhs.jcp.with_weights;
+}
+}  // namespace
+
 EmbeddingBagSum::EmbeddingBagSum(
             const std::shared_ptr<ngraph::Node>& op,
             size_t requiredInputNum,
@@ -39,41 +255,127 @@ EmbeddingBagSum::EmbeddingBagSum(
     }
 }
 
-void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
+void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& dataPrecision) {
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+    if (!isJitSupported(dataPrecision)) {
+        _kernel.reset();
+        return;
+    }
+    if (_kernel && _kernel->jcp_.emb_depth == _embDepth && _kernel->jcp_.prc == dataPrecision)
+        return;
+
+    auto builder = [](const EmbBagSumKey& key) -> std::shared_ptr<jit_uni_emb_bag_sum_kernel> {
+        std::shared_ptr<jit_uni_emb_bag_sum_kernel> kernel;
+        if (mayiuse(avx512_core)) {
+            kernel.reset(new jit_uni_emb_bag_sum_kernel_f32<avx512_core>(key.jcp));
+        } else if (mayiuse(avx2)) {
+            kernel.reset(new jit_uni_emb_bag_sum_kernel_f32<avx2>(key.jcp));
+        } else {
+            kernel.reset(new jit_uni_emb_bag_sum_kernel_f32<sse41>(key.jcp));
+        }
+        kernel->create_ker();
+        return kernel;
+    };
+
+    const jit_emb_bag_config_params jcp = {dataPrecision, _embDepth, _withWeights};
+    _kernel = getJitKernelsCache().getOrCreate(EmbBagSumKey{jcp}, builder).first;
 }
 
-template<typename T>
-void EmbeddingBagSum::processData(const T* srcData, const T* weightsData, T* dstData,
-                                  const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
-    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+bool EmbeddingBagSum::isJitSupported(const InferenceEngine::Precision& dataPrecision) {
+    // the store of the BF16 result requires avx512_core at least
+    return (dataPrecision == Precision::FP32 && mayiuse(sse41)) ||
+           (dataPrecision == Precision::BF16 && mayiuse(avx512_core));
+}
+
+impl_desc_type EmbeddingBagSum::getImplType(const InferenceEngine::Precision& dataPrecision) {
+    if (!isJitSupported(dataPrecision))
+        return impl_desc_type::ref_any;
+    if (mayiuse(avx512_core))
+        return impl_desc_type::jit_avx512;
+    if (mayiuse(avx2))
+        return impl_desc_type::jit_avx2;
+    return impl_desc_type::jit_sse42;
+}
 
+void EmbeddingBagSum::collectBags(size_t bagsNum) {
     initFromInputs();
 
-    const size_t outputBagsNum = outDataDims[0];
+    _bags.resize(bagsNum);
+    parallel_for(bagsNum, [&](size_t obi) {
+        auto& bag = _bags[obi];
+        bag = BagInfo();
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights & _withWeights;
+    });
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
+    _bagsWork.resize(bagsNum + 1);
+    _bagsWork[0] = 0lu;
+    for (size_t obi = 0; obi < bagsNum; obi++) {
+        // the bag output row is written even if there is nothing to gather
+        _bagsWork[obi + 1] = _bagsWork[obi] + (_bags[obi].indices ? _bags[obi].size : 0lu) + 1lu;
+    }
+}
 
-        size_t indicesSize = 0lu;
-        const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
+template<typename F>
+void EmbeddingBagSum::forEachBag(const F& func) const {
+    const size_t bagsNum = _bags.size();
+    const size_t totalWork = _bagsWork[bagsNum];
+
+    // The bags are split between the threads by the number of the gathered rows instead of the bags count,
+    // so a few large bags do not stall a single thread.
+    auto threadBody = [&](const int ithr, const int nthr) {
+        const size_t workStart = totalWork * ithr / nthr;
+        const size_t workEnd = totalWork * (ithr + 1) / nthr;
+        const auto first = _bagsWork.begin();
+        const auto last = _bagsWork.begin() + bagsNum;
+        const size_t start = std::lower_bound(first, last, workStart) - first;
+        const size_t end = std::lower_bound(first, last, workEnd) - first;
 
         for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            func(obi, _bags[obi]);
+        }
+    };
 
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
+    parallel_nt(0, threadBody);
+}
+
+template<typename T>
+void EmbeddingBagSum::processData(const T* srcData, const T* weightsData, T* dstData,
+                                  const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    collectBags(outDataDims[0]);
+
+    forEachBag([&](size_t obi, const BagInfo& bag) {
+        size_t dstIndex = obi * _embDepth;
+        const int* indices = bag.indices;
+        const size_t indicesSize = bag.size;
+        int weightsIdx = bag.weightsIdx;
+        const bool withWeights = bag.withWeights;
+
+        if (indices != nullptr) {
+            size_t inIdx = 0lu;
+            if (indices[inIdx] >= inDataDims[0]) {
+                IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+            }
+            size_t srcIndex = indices[inIdx] * _embDepth;
 
-                size_t inIdx = 0lu;
+            if (withWeights) {
+                for (size_t i = 0lu; i < _embDepth; i++) {
+                    dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
+                }
+                weightsIdx++;
+            } else {
+                for (size_t i = 0lu; i < _embDepth; i++) {
+                    dstData[dstIndex + i] = srcData[srcIndex + i];
+                }
+            }
+
+            for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
                 if (indices[inIdx] >= inDataDims[0]) {
                     IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
                 }
@@ -81,45 +383,70 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData, T* dst
 
                 if (withWeights) {
                     for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
+                        dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
                     }
                     weightsIdx++;
                 } else {
                     for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
+                        dstData[dstIndex + i] += srcData[srcIndex + i];
                     }
                 }
+            }
+        } else {
+            for (size_t i = 0lu; i < _embDepth; i++) {
+                dstData[dstIndex + i] = 0;
+            }
+        }
+    });
+}
 
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
-                }
-            } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
-                }
+void EmbeddingBagSum::processDataJit(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                                     const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+    if (!_kernel)
+        IE_THROW() << msgPrefix << "doesn't have the kernel compiled.";
+
+    // the weight of the default index, which is used for the empty bags only, the kernel doesn't distinguish it
+    static const float oneFP32 = 1.f;
+    static const uint16_t oneBF16 = 0x3f80;
+
+    const size_t prcSize = _kernel->jcp_.prc.size();
+    const void* oneWeight = _kernel->jcp_.prc == Precision::BF16 ? static_cast<const void*>(&oneBF16)
+                                                                   : static_cast<const void*>(&oneFP32);
+    const size_t rowsNum = inDataDims[0];
+
+    collectBags(outDataDims[0]);
+
+    forEachBag([&](size_t obi, const BagInfo& bag) {
+        uint8_t* dst = dstData + obi * _embDepth * prcSize;
+        if (bag.indices == nullptr) {
+            memset(dst, 0, _embDepth * prcSize);
+            return;
+        }
+
+        for (size_t i = 0lu; i < bag.size; i++) {
+            if (static_cast<size_t>(bag.indices[i]) >= rowsNum) {
+                IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(bag.indices[i]);
             }
         }
-    };
 
-    parallel_nt(0, threadBody);
+        auto arg = jit_emb_bag_call_args();
+        arg.src = srcData;
+        arg.dst = dst;
+        arg.indices = bag.indices;
+        arg.indices_num = bag.size;
+        if (_withWeights)
+            arg.weights = bag.withWeights ? weightsData + bag.weightsIdx * prcSize : oneWeight;
+        (*_kernel)(&arg);
+    });
 }
 
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
                               const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims) {
+    if (_kernel && _kernel->jcp_.prc == srcPrc) {
+        return processDataJit(srcData, weightsData, dstData, inDims, outDims);
+    }
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
@@ -14,6 +14,36 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+struct jit_emb_bag_config_params {
+    InferenceEngine::Precision prc;
+    size_t emb_depth;
+    bool with_weights;
+};
+
+struct jit_emb_bag_call_args {
+    const void *src;
+    void *dst;
+    const int *indices;
+    const void *weights;
+    size_t indices_num;
+};
+
+struct jit_uni_emb_bag_sum_kernel {
+    void (*ker_)(const jit_emb_bag_call_args *);
+
+    void operator()(const jit_emb_bag_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_emb_bag_sum_kernel(jit_emb_bag_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_emb_bag_sum_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_emb_bag_config_params jcp_;
+};
+
 class EmbeddingBagSum {
 public:
     EmbeddingBagSum(
@@ -37,11 +67,28 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& dataPrecision);
+
+    // FP32 and BF16 tables are processed by the JIT kernel, the BF16 one is accumulated in FP32
+    static bool isJitSupported(const InferenceEngine::Precision& dataPrecision);
+    static impl_desc_type getImplType(const InferenceEngine::Precision& dataPrecision);
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData, T* dstData,
                      const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
+    void processDataJit(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                        const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
+
+    struct BagInfo {
+        const int* indices = nullptr;
+        size_t size = 0lu;
+        int weightsIdx = 0;
+        bool withWeights = false;
+    };
+
+    void collectBags(size_t bagsNum);
+    template<typename F>
+    void forEachBag(const F& func) const;
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -51,6 +98,11 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::vector<BagInfo> _bags;
+    // exclusive prefix sum of the bags work, which is the number of the gathered rows
+    std::vector<size_t> _bagsWork;
+    std::shared_ptr<jit_uni_emb_bag_sum_kernel> _kernel;
 };
 
 }   // namespace node
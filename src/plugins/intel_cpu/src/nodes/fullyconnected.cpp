@@ -6,8 +6,11 @@
 #include "eltwise.h"
 #include "fake_quantize.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
+#include "ngraph_transformations/fc_weights_decompression.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
+#include <algorithm>
+#include <numeric>
 #include <vector>
 #include <dnnl_extension_utils.h>
 #include <onednn/dnnl.h>
@@ -16,9 +19,17 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/cpu_utils.hpp"
 #include <common/primitive_hashing_utils.hpp>
+#include "ie_parallel.hpp"
+#include "emitters/jit_load_store_emitters.hpp"
+
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace dnnl;
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_fc_decompression_call_args, field)
 
 namespace ov {
 namespace intel_cpu {
@@ -73,8 +84,284 @@ bool FCKey::operator==(const FCKey &rhs) const {
     return retVal;
 }
 
+struct FCDecompressionKey {
+    jit_fc_decompression_config_params jcp;
+
+    size_t hash() const;
+    bool operator==(const FCDecompressionKey& rhs) const;
+};
+
+size_t FCDecompressionKey::hash() const {
+    using namespace dnnl::impl;
+
+    size_t seed = 0;
+
+    seed = hash_combine(seed, jcp.wei_prc.getPrecVal());
+    seed = hash_combine(seed, jcp.wei_int4);
+    seed = hash_combine(seed, jcp.with_zero_points);
+    seed = hash_combine(seed, jcp.with_bias);
+    seed = hash_combine(seed, jcp.ic);
+    seed = hash_combine(seed, jcp.group_size);
+    seed = hash_combine(seed, jcp.rows);
+    return seed;
+}
+
+bool FCDecompressionKey::operator==(const FCDecompressionKey& rhs) const {
+    return jcp.wei_prc == rhs.jcp.wei_prc &&
+           jcp.wei_int4 == rhs.jcp.wei_int4 &&
+           jcp.with_zero_points == rhs.jcp.with_zero_points &&
+           jcp.with_bias == rhs.jcp.with_bias &&
+           jcp.ic == rhs.jcp.ic &&
+           jcp.group_size == rhs.jcp.group_size &&
+           jcp.rows == rhs.jcp.rows;
+}
+
+// number of the source rows sharing the decompressed weights vector in the main kernel
+constexpr size_t decompressionBlockRows = 4;
+
+// number of the weights elements decompressed at once for the GEMM computing the large inputs
+constexpr size_t decompressionTileSize = 256 * 1024;
+
+size_t decompressionVectorStep() {
+    return (mayiuse(avx512_core) ? cpu_isa_traits<avx512_core>::vlen : cpu_isa_traits<avx2>::vlen) / sizeof(float);
+}
+
 } // namespace
 
+// The weights vector is loaded once per output channel and group step, converted to FP32, decompressed
+// ((w - zero_point) * scale) and multiplied by the same slice of every source row, so the weights are read
+// from memory in the compressed precision only. The 4-bit weights are packed by two per byte: the byte j
+// of a 2 * vector_step block holds the element j in the low nibble and the element j + vector_step in the high one.
+template <cpu_isa_t isa>
+struct jit_uni_fc_decompression_kernel_f32 : public jit_uni_fc_decompression_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_decompression_kernel_f32)
+
+    explicit jit_uni_fc_decompression_kernel_f32(jit_fc_decompression_config_params jcp)
+        : jit_uni_fc_decompression_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        tail_step = jcp_.wei_int4 ? 0 : jcp_.group_size % vector_step;
+
+        if (!jcp_.wei_int4)
+            load_wei_emitter.reset(new jit_load_emitter(this, isa, jcp_.wei_prc, Precision::FP32, vector_step));
+        if (tail_step != 0) {
+            // the source lanes out of the group are zeroed, so they don't contribute to the sums
+            load_wei_tail_emitter.reset(new jit_load_emitter(this, isa, jcp_.wei_prc, Precision::FP32, tail_step,
+                                                             Precision::FP32, true));
+            load_src_tail_emitter.reset(new jit_load_emitter(this, isa, Precision::FP32, Precision::FP32, tail_step,
+                                                             Precision::FP32, true));
+        }
+
+        this->preamble();
+
+        mov(reg_src[0], ptr[reg_params + GET_OFF(src)]);
+        mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+        for (size_t r = 1; r < jcp_.rows; r++)
+            lea(reg_src[r], ptr[reg_src[r - 1] + reg_src_stride]);
+        mov(reg_wei, ptr[reg_params + GET_OFF(wei)]);
+        mov(reg_scales, ptr[reg_params + GET_OFF(scales)]);
+        if (jcp_.with_zero_points)
+            mov(reg_zero_points, ptr[reg_params + GET_OFF(zero_points)]);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+
+        for (size_t r = 0; r < jcp_.rows; r++)
+            uni_vpxor(vmm_acc(r), vmm_acc(r), vmm_acc(r));
+
+        if (jcp_.wei_int4) {
+            mov(reg_tmp.cvt32(), 0x0F);
+            uni_vmovd(Xmm(vmm_mask.getIdx()), reg_tmp.cvt32());
+            uni_vpbroadcastd(vmm_mask, Xmm(vmm_mask.getIdx()));
+        }
+
+        Xbyak::Label group_loop_label;
+        Xbyak::Label group_loop_end_label;
+
+        mov(reg_groups, jcp_.ic / jcp_.group_size);
+        L(group_loop_label);
+        {
+            cmp(reg_groups, 0);
+            jle(group_loop_end_label, T_NEAR);
+
+            uni_vbroadcastss(vmm_scale, ptr[reg_scales]);
+            if (jcp_.with_zero_points)
+                uni_vbroadcastss(vmm_zero_point, ptr[reg_zero_points]);
+
+            worker_group();
+
+            add(reg_scales, sizeof(float));
+            if (jcp_.with_zero_points)
+                add(reg_zero_points, sizeof(float));
+            sub(reg_groups, 1);
+            jmp(group_loop_label, T_NEAR);
+        }
+        L(group_loop_end_label);
+
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+        if (jcp_.with_bias)
+            mov(reg_bias, ptr[reg_params + GET_OFF(bias)]);
+
+        for (size_t r = 0; r < jcp_.rows; r++) {
+            horizontal_sum(vmm_acc(r));
+            const Xmm xmm_acc = Xmm(vmm_acc(r).getIdx());
+            if (jcp_.with_bias)
+                uni_vaddss(xmm_acc, xmm_acc, ptr[reg_bias]);
+            uni_vmovss(ptr[reg_dst], xmm_acc);
+            add(reg_dst, reg_dst_stride);
+        }
+
+        this->postamble();
+
+        if (load_wei_emitter)
+            load_wei_emitter->emit_data();
+        if (tail_step != 0) {
+            load_wei_tail_emitter->emit_data();
+            load_src_tail_emitter->emit_data();
+        }
+    }
+
+private:
+    using Vmm = typename conditional3<isa == sse41, Xbyak::Xmm, isa == avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int vector_step = vlen / sizeof(float);
+    size_t tail_step = 0;
+
+    const Xbyak::Reg64 reg_src[decompressionBlockRows] = {r8, rax, rbx, rdx};
+    Xbyak::Reg64 reg_src_stride = r9;
+    Xbyak::Reg64 reg_wei = r10;
+    Xbyak::Reg64 reg_scales = r11;
+    Xbyak::Reg64 reg_zero_points = r12;
+    Xbyak::Reg64 reg_groups = r13;
+    Xbyak::Reg64 reg_work_amount = r14;
+    Xbyak::Reg64 reg_tmp = rsi;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // the pointers are free after the reduction loop
+    Xbyak::Reg64 reg_dst = reg_wei;
+    Xbyak::Reg64 reg_dst_stride = reg_work_amount;
+    Xbyak::Reg64 reg_bias = reg_scales;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_store_mask = rbp;
+
+    // Vmm(0) .. Vmm(rows - 1) are the accumulators
+    Vmm vmm_wei = Vmm(4);
+    Vmm vmm_wei_hi = Vmm(5);
+    Vmm vmm_scale = Vmm(6);
+    Vmm vmm_zero_point = Vmm(7);
+    Vmm vmm_src = Vmm(8);
+    Vmm vmm_mask = Vmm(9);
+    Vmm vmm_aux = Vmm(10);
+
+    std::unique_ptr<jit_load_emitter> load_wei_emitter = nullptr;
+    std::unique_ptr<jit_load_emitter> load_wei_tail_emitter = nullptr;
+    std::unique_ptr<jit_load_emitter> load_src_tail_emitter = nullptr;
+
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    inline Vmm vmm_acc(size_t row) {
+        return Vmm(row);
+    }
+
+    inline void decompress(const Vmm &vmm) {
+        if (jcp_.with_zero_points)
+            uni_vsubps(vmm, vmm, vmm_zero_point);
+        uni_vmulps(vmm, vmm, vmm_scale);
+    }
+
+    inline void worker_group() {
+        const size_t block_step = jcp_.wei_int4 ? 2 * vector_step : vector_step;
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        mov(reg_work_amount, jcp_.group_size / block_step);
+        L(loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            if (jcp_.wei_int4)
+                worker_int4();
+            else
+                worker(false);
+
+            sub(reg_work_amount, 1);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        if (tail_step != 0)
+            worker(true);
+    }
+
+    inline void worker(bool is_tail) {
+        const auto& load_emitter = is_tail ? load_wei_tail_emitter : load_wei_emitter;
+        load_emitter->emit_code({static_cast<size_t>(reg_wei.getIdx())}, {static_cast<size_t>(vmm_wei.getIdx())},
+            {}, {load_pool_gpr_idxs});
+        decompress(vmm_wei);
+
+        for (size_t r = 0; r < jcp_.rows; r++) {
+            if (is_tail) {
+                load_src_tail_emitter->emit_code({static_cast<size_t>(reg_src[r].getIdx())}, {static_cast<size_t>(vmm_src.getIdx())},
+                    {}, {load_pool_gpr_idxs});
+                uni_vfmadd231ps(vmm_acc(r), vmm_wei, vmm_src);
+            } else {
+                uni_vfmadd231ps(vmm_acc(r), vmm_wei, ptr[reg_src[r]]);
+            }
+        }
+
+        const size_t step = is_tail ? tail_step : vector_step;
+        add(reg_wei, static_cast<int>(step * jcp_.wei_prc.size()));
+        for (size_t r = 0; r < jcp_.rows; r++)
+            add(reg_src[r], static_cast<int>(step * sizeof(float)));
+    }
+
+    inline void worker_int4() {
+        // the signed weights are packed with the +8 offset, which is compensated by the zero points
+        uni_vpmovzxbd(vmm_wei, ptr[reg_wei]);
+        uni_vpsrld(vmm_wei_hi, vmm_wei, 4);
+        uni_vpand(vmm_wei, vmm_wei, vmm_mask);
+        uni_vcvtdq2ps(vmm_wei, vmm_wei);
+        uni_vcvtdq2ps(vmm_wei_hi, vmm_wei_hi);
+        decompress(vmm_wei);
+        decompress(vmm_wei_hi);
+
+        for (size_t r = 0; r < jcp_.rows; r++) {
+            uni_vfmadd231ps(vmm_acc(r), vmm_wei, ptr[reg_src[r]]);
+            uni_vfmadd231ps(vmm_acc(r), vmm_wei_hi, ptr[reg_src[r] + vlen]);
+        }
+
+        add(reg_wei, vector_step);
+        for (size_t r = 0; r < jcp_.rows; r++)
+            add(reg_src[r], 2 * vlen);
+    }
+
+    // the sum of the vector lanes is placed to the lowest one
+    inline void horizontal_sum(const Vmm &vmm) {
+        const Xbyak::Xmm xmm = Xbyak::Xmm(vmm.getIdx());
+        const Xbyak::Xmm xmm_aux = Xbyak::Xmm(vmm_aux.getIdx());
+        if (isa == avx512_core) {
+            vextractf64x4(Xbyak::Ymm(vmm_aux.getIdx()), Xbyak::Zmm(vmm.getIdx()), 1);
+            uni_vaddps(Xbyak::Ymm(vmm.getIdx()), Xbyak::Ymm(vmm.getIdx()), Xbyak::Ymm(vmm_aux.getIdx()));
+        }
+        vextractf128(xmm_aux, Xbyak::Ymm(vmm.getIdx()), 1);
+        uni_vaddps(xmm, xmm, xmm_aux);
+        uni_vmovshdup(xmm_aux, xmm);
+        uni_vaddps(xmm, xmm, xmm_aux);
+        uni_vmovhlps(xmm_aux, xmm_aux, xmm);
+        uni_vaddps(xmm, xmm, xmm_aux);
+    }
+};
+
 bool FullyConnected::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto fc = std::dynamic_pointer_cast<const FullyConnectedNode>(op);
@@ -164,6 +451,9 @@ void FullyConnected::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    if (withWeightsDecompression())
+        return;
+
     auto inputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     outputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -213,6 +503,17 @@ void FullyConnected::prepareParams() {
         IE_THROW() << "Input memory hasn't been allocated.";
     if (!wghMemPtr || !wghMemPtr->isAllocated())
         IE_THROW() << "Weight memory hasn't been allocated.";
+
+    if (withWeightsDecompression()) {
+        const auto& srcDims = srcMemPtr->getStaticDims();
+        const size_t rows = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+        // the large inputs are computed by GEMM over the weights decompressed by tiles
+        decompressionKernelSelected = is_decompression_kernel_applicable(rows);
+        if (decompressionKernelSelected)
+            prepareDecompressionParams();
+        return;
+    }
+
     MemoryPtr biasMemPtr = nullptr;
     if (withBiases) {
         biasMemPtr = getParentEdgesAtPort(2)[0]->getMemoryPtr();
@@ -329,6 +630,11 @@ void FullyConnected::prepareParams() {
 }
 
 void FullyConnected::setDynamicBatchLim(int lim) {
+    if (withWeightsDecompression()) {
+        Node::setDynamicBatchLim(lim);
+        return;
+    }
+
     dynBatchLim = lim;
 
     auto setBatchPrimArgs = [this](int argType, const dnnl::memory& oldMem) {
@@ -350,7 +656,12 @@ void FullyConnected::setDynamicBatchLim(int lim) {
 }
 
 void FullyConnected::execute(dnnl::stream strm) {
-    if (prim) {
+    if (withWeightsDecompression()) {
+        if (decompressionKernelSelected)
+            executeDecompression();
+        else
+            executeDecompressionGemm();
+    } else if (prim) {
         // in cases parameter -> FullyConnected or dynamic shapes
         // we keep old pointer to data in primArgs on second iteration with same input shapes
         auto updateMemoryPtr = [this](int argType) {
@@ -377,6 +688,9 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // the decompression kernel has no post ops support
+    if (withWeightsDecompression())
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -574,6 +888,11 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (withWeightsDecompression()) {
+        initDecompressionDescriptors();
+        return;
+    }
+
     for (auto& desc : descs) {
         auto itpd = desc.createPrimitiveDescriptorIterator(getEngine());
         while (static_cast<bool>(itpd)) {
@@ -663,6 +982,219 @@ InferenceEngine::Precision FullyConnected::getRuntimePrecision() const {
     return getMaxPrecision(inputPrecisions);
 }
 
+MemoryPtr FullyConnected::fuseDecompression(const MemoryCPtr& weights, std::vector<float> scales,
+                                            std::vector<float> zeroPoints, size_t groupSize) {
+    decompressionWeightsPrc = weights->getDesc().getPrecision();
+    decompressionScales = std::move(scales);
+    decompressionZeroPoints = std::move(zeroPoints);
+    decompressionGroupSize = groupSize;
+    setOriginalInputPrecisionAtPort(WEIGHTS_ID, decompressionWeightsPrc);
+
+    auto packed = packInt4Weights(weights);
+    decompressionInt4 = packed != nullptr;
+    if (decompressionInt4 && decompressionWeightsPrc == Precision::I8) {
+        // the signed weights are packed with the +8 offset
+        if (decompressionZeroPoints.empty())
+            decompressionZeroPoints.resize(decompressionScales.size(), 0.f);
+        for (auto& zp : decompressionZeroPoints)
+            zp += 8.f;
+    }
+    return packed;
+}
+
+void FullyConnected::initDecompressionDescriptors() {
+    const impl_desc_type implType = mayiuse(avx512_core) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+
+    const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    std::vector<PortConfigurator> inConfs = {{LayoutType::ncsp, Precision::FP32}};
+    if (decompressionInt4) {
+        inConfs.emplace_back(LayoutType::ncsp, Precision::U8, Shape(VectorDims{weightsDims[0], weightsDims[1] / 2}));
+    } else {
+        inConfs.emplace_back(LayoutType::ncsp, decompressionWeightsPrc);
+    }
+    if (withBiases)
+        inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+
+    addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, Precision::FP32}}, implType);
+}
+
+MemoryPtr FullyConnected::packInt4Weights(const MemoryCPtr& weights) {
+    const size_t vectorStep = decompressionVectorStep();
+    const size_t blockSize = 2 * vectorStep;
+    if (decompressionGroupSize % blockSize != 0)
+        return nullptr;
+
+    const bool isSigned = decompressionWeightsPrc == Precision::I8;
+    const auto src = static_cast<const uint8_t*>(weights->GetPtr());
+    const size_t size = weights->GetSize();
+    auto toNibble = [isSigned](uint8_t value) {
+        return isSigned ? static_cast<int>(static_cast<int8_t>(value)) + 8 : static_cast<int>(value);
+    };
+    for (size_t i = 0; i < size; i++) {
+        const int value = toNibble(src[i]);
+        if (value < 0 || value > 15)
+            return nullptr;
+    }
+
+    auto create = [&]() {
+        MemoryPtr packed = std::make_shared<Memory>(getEngine());
+        const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+        packed->Create(CpuBlockedMemoryDesc(Precision::U8, Shape(VectorDims{weightsDims[0], weightsDims[1] / 2})));
+        auto dst = static_cast<uint8_t*>(packed->GetPtr());
+        parallel_for(size / blockSize, [&](size_t b) {
+            const uint8_t* srcBlock = src + b * blockSize;
+            uint8_t* dstBlock = dst + b * vectorStep;
+            for (size_t j = 0; j < vectorStep; j++)
+                dstBlock[j] = static_cast<uint8_t>(toNibble(srcBlock[j]) | (toNibble(srcBlock[j + vectorStep]) << 4));
+        });
+        return packed;
+    };
+
+    if (weightCache == nullptr)
+        return create();
+
+    const uint64_t dataHash = weightCache->GetHashFunc().hash(src, size);
+    const std::string key = getName() + "_int4_" + std::to_string(vectorStep) + "_" + std::to_string(dataHash);
+    return *weightCache->findOrCreate(key, create);
+}
+
+void FullyConnected::prepareDecompressionParams() {
+    // the kernels depend on the weights only, so they are created once
+    if (decompressionKernel)
+        return;
+
+    jit_fc_decompression_config_params jcp;
+    jcp.wei_prc = decompressionWeightsPrc;
+    jcp.ic = getInputShapeAtPort(WEIGHTS_ID).getStaticDims()[1];
+    jcp.group_size = decompressionGroupSize;
+    jcp.with_bias = withBiases;
+    jcp.wei_int4 = decompressionInt4;
+    jcp.with_zero_points = !decompressionZeroPoints.empty();
+
+    auto builder = [](const FCDecompressionKey& key) -> std::shared_ptr<jit_uni_fc_decompression_kernel> {
+        std::shared_ptr<jit_uni_fc_decompression_kernel> kernel;
+        if (mayiuse(avx512_core)) {
+            kernel.reset(new jit_uni_fc_decompression_kernel_f32<avx512_core>(key.jcp));
+        } else {
+            kernel.reset(new jit_uni_fc_decompression_kernel_f32<avx2>(key.jcp));
+        }
+        kernel->create_ker();
+        return kernel;
+    };
+
+    // the graph cache keeps the statistics, the kernels themselves are shared by the whole process
+    auto sharedBuilder = [&builder](const FCDecompressionKey& key) {
+        return getJitKernelsCache().getOrCreate(key, builder).first;
+    };
+
+    auto cache = getRuntimeCache();
+    jcp.rows = decompressionBlockRows;
+    decompressionKernel = cache->getOrCreate(FCDecompressionKey{jcp}, sharedBuilder).first;
+    jcp.rows = 1;
+    decompressionTailKernel = cache->getOrCreate(FCDecompressionKey{jcp}, sharedBuilder).first;
+    if (!decompressionKernel || !decompressionTailKernel)
+        IE_THROW() << "Can't create the weights decompression kernel for node " << getName() << ".";
+}
+
+void FullyConnected::executeDecompression() {
+    auto srcMemPtr = getParentEdgesAtPort(DATA_ID)[0]->getMemoryPtr();
+    auto wghMemPtr = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemoryPtr();
+    auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
+
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    const size_t IC = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    const size_t OC = dstMemPtr->getStaticDims().back();
+    const size_t G = IC / decompressionGroupSize;
+
+    const auto src = reinterpret_cast<const float*>(srcMemPtr->GetPtr());
+    auto dst = reinterpret_cast<float*>(dstMemPtr->GetPtr());
+    const float* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemoryPtr()->GetPtr()) : nullptr;
+    const float* zeroPoints = decompressionZeroPoints.empty() ? nullptr : decompressionZeroPoints.data();
+
+    const auto wei = static_cast<const uint8_t*>(wghMemPtr->GetPtr());
+    const size_t weiStride = decompressionInt4 ? IC / 2 : IC;
+    parallel_for(OC, [&](size_t oc) {
+        auto args = jit_fc_decompression_call_args();
+        args.wei = wei + oc * weiStride;
+        args.scales = &decompressionScales[oc * G];
+        args.zero_points = zeroPoints ? zeroPoints + oc * G : nullptr;
+        args.bias = bias ? bias + oc : nullptr;
+        args.src_stride = IC * sizeof(float);
+        args.dst_stride = OC * sizeof(float);
+
+        size_t m = 0;
+        for (; m + decompressionBlockRows <= M; m += decompressionBlockRows) {
+            args.src = src + m * IC;
+            args.dst = dst + m * OC + oc;
+            (*decompressionKernel)(&args);
+        }
+        for (; m < M; m++) {
+            args.src = src + m * IC;
+            args.dst = dst + m * OC + oc;
+            (*decompressionTailKernel)(&args);
+        }
+    });
+}
+
+void FullyConnected::executeDecompressionGemm() {
+    auto srcMemPtr = getParentEdgesAtPort(DATA_ID)[0]->getMemoryPtr();
+    auto wghMemPtr = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemoryPtr();
+    auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
+
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    const size_t IC = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    const size_t OC = dstMemPtr->getStaticDims().back();
+    const size_t G = IC / decompressionGroupSize;
+
+    const auto src = reinterpret_cast<const float*>(srcMemPtr->GetPtr());
+    auto dst = reinterpret_cast<float*>(dstMemPtr->GetPtr());
+    const float* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemoryPtr()->GetPtr()) : nullptr;
+    const auto wei = static_cast<const uint8_t*>(wghMemPtr->GetPtr());
+    const size_t weiStride = decompressionInt4 ? IC / 2 : IC;
+    const size_t vectorStep = decompressionVectorStep();
+    const bool isSigned = decompressionWeightsPrc == Precision::I8 && !decompressionInt4;
+
+    // only a tile of the weights is decompressed at once, so the FP32 copy of the weights is never stored
+    const size_t tileOC = std::min(OC, std::max(decompressionTileSize / IC, size_t{1}));
+    std::vector<float> tile(tileOC * IC);
+    for (size_t oc0 = 0; oc0 < OC; oc0 += tileOC) {
+        const size_t curOC = std::min(tileOC, OC - oc0);
+        parallel_for(curOC, [&](size_t i) {
+            const size_t oc = oc0 + i;
+            const uint8_t* w = wei + oc * weiStride;
+            float* t = &tile[i * IC];
+            for (size_t k = 0; k < IC; k++) {
+                int value;
+                if (decompressionInt4) {
+                    // see the packed layout description of the kernel
+                    const size_t block = k / (2 * vectorStep), j = k % (2 * vectorStep);
+                    const uint8_t byte = w[block * vectorStep + j % vectorStep];
+                    value = j < vectorStep ? byte & 0xF : byte >> 4;
+                } else {
+                    value = isSigned ? static_cast<int>(static_cast<int8_t>(w[k])) : static_cast<int>(w[k]);
+                }
+                const size_t g = oc * G + k / decompressionGroupSize;
+                const float zp = decompressionZeroPoints.empty() ? 0.f : decompressionZeroPoints[g];
+                t[k] = (static_cast<float>(value) - zp) * decompressionScales[g];
+            }
+        });
+
+        // dst[M, curOC] = src[M, IC] * tile[curOC, IC]^T, the rows of dst are OC elements apart
+        const auto status = dnnl_sgemm('N', 'T', M, curOC, IC, 1.f, src, IC, tile.data(), IC, 0.f, dst + oc0, OC);
+        if (status != dnnl_success)
+            IE_THROW() << "GEMM execution failed for node " << getName() << ".";
+    }
+
+    if (bias) {
+        parallel_for(M, [&](size_t m) {
+            for (size_t oc = 0; oc < OC; oc++)
+                dst[m * OC + oc] += bias[oc];
+        });
+    }
+}
+
 }   // namespace node
 }   // namespace intel_cpu
 }   // namespace ov
@@ -14,6 +14,45 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+struct jit_fc_decompression_config_params {
+    InferenceEngine::Precision wei_prc;
+    bool wei_int4;          // two 4-bit weights per byte, see FullyConnected::packInt4Weights
+    bool with_zero_points;
+    bool with_bias;
+    size_t ic;
+    size_t group_size;
+    size_t rows;            // number of the source rows processed per call
+};
+
+struct jit_fc_decompression_call_args {
+    const float *src;
+    const void *wei;
+    const float *scales;
+    const float *zero_points;
+    const float *bias;
+    float *dst;
+    size_t src_stride;      // in bytes
+    size_t dst_stride;      // in bytes
+};
+
+// Computes a single output channel for jcp_.rows source rows, the weights are decompressed on the fly:
+// dst[r] = bias + sum_k src[r][k] * (wei[k] - zero_points[g]) * scales[g], g = k / group_size
+struct jit_uni_fc_decompression_kernel {
+    void (*ker_)(const jit_fc_decompression_call_args *);
+
+    void operator()(const jit_fc_decompression_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_fc_decompression_kernel(jit_fc_decompression_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_fc_decompression_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_fc_decompression_config_params jcp_;
+};
+
 class FullyConnected : public Node {
 public:
     FullyConnected(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
@@ -56,6 +95,22 @@ public:
 
     void setDynamicBatchLim(int lim) override;
 
+    /**
+     * @brief Keeps the weights in the compressed integer precision, they are decompressed inside the kernel.
+     * @param weights the compressed weights constant (U8 or I8)
+     * @param scales per output channel and group scales in the [OC, IC / groupSize] layout
+     * @param zeroPoints the zero points in the same layout as the scales, empty if there are no zero points
+     * @param groupSize number of the input channels sharing the same scale and zero point
+     * @return the weights packed by two per byte if all the values fit into 4 bits, they replace the weights input
+     * of the node; nullptr if the weights are used as is
+     */
+    MemoryPtr fuseDecompression(const MemoryCPtr& weights, std::vector<float> scales, std::vector<float> zeroPoints,
+                                size_t groupSize);
+
+    bool withWeightsDecompression() const {
+        return !decompressionScales.empty();
+    }
+
 private:
     void createDescriptorInternal(const dnnl::memory::desc &inputDesc,
                                   const dnnl::memory::desc &outputDesc);
@@ -75,6 +130,22 @@ private:
     static const size_t WEIGHTS_ID = 1;
     static const size_t BIAS_ID = 2;
     dnnl::memory::data_type outputDataType;
+
+    void initDecompressionDescriptors();
+    void prepareDecompressionParams();
+    void executeDecompression();
+    void executeDecompressionGemm();
+    MemoryPtr packInt4Weights(const MemoryCPtr& weights);
+
+    InferenceEngine::Precision decompressionWeightsPrc;
+    std::vector<float> decompressionScales;
+    // the signed packed weights are stored with the +8 offset, which is added to the zero points
+    std::vector<float> decompressionZeroPoints;
+    size_t decompressionGroupSize = 0;
+    bool decompressionInt4 = false;
+    bool decompressionKernelSelected = false;
+    std::shared_ptr<jit_uni_fc_decompression_kernel> decompressionKernel;
+    std::shared_ptr<jit_uni_fc_decompression_kernel> decompressionTailKernel;
 };
 
 }   // namespace node
@@ -0,0 +1,242 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "grid_sample.h"
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <ngraph/opsets/opset9.hpp>
+#include "ie_parallel.hpp"
+#include "utils/general_utils.h"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+namespace {
+
+// number of the output points processed by a single parallel task
+constexpr size_t pointsBlock = 256;
+
+inline float denormalize(float value, size_t range, bool alignCorners) {
+    return alignCorners ? (value + 1.f) * (static_cast<float>(range) - 1.f) / 2.f
+                        : ((value + 1.f) * static_cast<float>(range) - 1.f) / 2.f;
+}
+
+// the same coefficients as in the reference implementation (A = -0.75)
+inline void cubicCoeffs(float r, float coeffs[4]) {
+    const float A = -0.75f;
+    coeffs[0] = ((A * (r + 1) - 5 * A) * (r + 1) + 8 * A) * (r + 1) - 4 * A;
+    coeffs[1] = ((A + 2) * r - (A + 3)) * r * r + 1;
+    coeffs[2] = ((A + 2) * (1 - r) - (A + 3)) * (1 - r) * (1 - r) + 1;
+    coeffs[3] = ((A * (2 - r) - 5 * A) * (2 - r) + 8 * A) * (2 - r) - 4 * A;
+}
+
+} // namespace
+
+bool GridSample::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!ov::is_type<ov::op::v9::GridSample>(op)) {
+            errorMessage = "Only opset9 GridSample operation is supported";
+            return false;
+        }
+        if (!op->get_input_element_type(DATA_ID).is_real() || !op->get_input_element_type(GRID_ID).is_real()) {
+            errorMessage = "Only floating point data and grid are supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+GridSample::GridSample(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache)
+        : Node(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+    errorPrefix = "GridSample node with name '" + getName() + "'";
+
+    if (inputShapes.size() != 2 || outputShapes.size() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input/output edges!";
+    if (getInputShapeAtPort(DATA_ID).getRank() != 4 || getInputShapeAtPort(GRID_ID).getRank() != 4)
+        IE_THROW() << errorPrefix << " supports only 4D data and grid inputs";
+
+    const auto& attributes = ov::as_type_ptr<const ov::op::v9::GridSample>(op)->get_attributes();
+    alignCorners = attributes.align_corners;
+    switch (attributes.mode) {
+        case ov::op::v9::GridSample::InterpolationMode::BILINEAR:
+            interpolationMode = InterpolationMode::Bilinear;
+            pointsPerSample = 4;
+            break;
+        case ov::op::v9::GridSample::InterpolationMode::BICUBIC:
+            interpolationMode = InterpolationMode::Bicubic;
+            pointsPerSample = 16;
+            break;
+        case ov::op::v9::GridSample::InterpolationMode::NEAREST:
+            interpolationMode = InterpolationMode::Nearest;
+            pointsPerSample = 1;
+            break;
+        default:
+            IE_THROW() << errorPrefix << " has unsupported interpolation mode";
+    }
+    switch (attributes.padding_mode) {
+        case ov::op::v9::GridSample::PaddingMode::ZEROS:
+            paddingMode = PaddingMode::Zeros;
+            break;
+        case ov::op::v9::GridSample::PaddingMode::BORDER:
+            paddingMode = PaddingMode::Border;
+            break;
+        case ov::op::v9::GridSample::PaddingMode::REFLECTION:
+            paddingMode = PaddingMode::Reflection;
+            break;
+        default:
+            IE_THROW() << errorPrefix << " has unsupported padding mode";
+    }
+}
+
+void GridSample::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // the data of the other floating point precisions is interpolated in FP32
+    addSupportedPrimDesc({{LayoutType::ncsp, Precision::FP32},
+                          {LayoutType::ncsp, Precision::FP32}},
+                         {{LayoutType::ncsp, Precision::FP32}},
+                         impl_desc_type::ref_any);
+}
+
+inline void GridSample::setSample(int64_t y, int64_t x, float weight, size_t H, size_t W, int32_t& index, float& sampleWeight) const {
+    const auto h = static_cast<int64_t>(H);
+    const auto w = static_cast<int64_t>(W);
+    switch (paddingMode) {
+        case PaddingMode::Zeros:
+            if (y < 0 || x < 0 || y >= h || x >= w) {
+                index = 0;
+                sampleWeight = 0.f;
+                return;
+            }
+            break;
+        case PaddingMode::Border:
+            y = std::min(std::max(y, int64_t{0}), h - 1);
+            x = std::min(std::max(x, int64_t{0}), w - 1);
+            break;
+        case PaddingMode::Reflection:
+            if (alignCorners) {
+                const int64_t h2 = h == 1 ? 1 : 2 * (h - 1);
+                const int64_t w2 = w == 1 ? 1 : 2 * (w - 1);
+                y = std::abs(y) % h2;
+                x = std::abs(x) % w2;
+                y = y >= h ? h2 - y : y;
+                x = x >= w ? w2 - x : x;
+            } else {
+                const int64_t h2 = 2 * h;
+                const int64_t w2 = 2 * w;
+                y = (y % h2 + h2) % h2;
+                x = (x % w2 + w2) % w2;
+                y = y >= h ? h2 - 1 - y : y;
+                x = x >= w ? w2 - 1 - x : x;
+            }
+            break;
+    }
+    index = static_cast<int32_t>(y * w + x);
+    sampleWeight = weight;
+}
+
+void GridSample::prepareSamples(const float* grid, size_t N, size_t H, size_t W, size_t points) {
+    const size_t samplesNum = N * points * pointsPerSample;
+    if (indices.size() < samplesNum) {
+        indices.resize(samplesNum);
+        weights.resize(samplesNum);
+    }
+
+    parallel_for2d(N, div_up(points, pointsBlock), [&](size_t n, size_t block) {
+        const size_t pointsEnd = std::min(points, (block + 1) * pointsBlock);
+        for (size_t p = block * pointsBlock; p < pointsEnd; p++) {
+            const float* g = grid + (n * points + p) * 2;
+            const float x = denormalize(g[0], W, alignCorners);
+            const float y = denormalize(g[1], H, alignCorners);
+            int32_t* idx = &indices[(n * points + p) * pointsPerSample];
+            float* wei = &weights[(n * points + p) * pointsPerSample];
+
+            if (interpolationMode == InterpolationMode::Nearest) {
+                setSample(std::lrint(y), std::lrint(x), 1.f, H, W, idx[0], wei[0]);
+                continue;
+            }
+
+            const float yTopLeft = std::floor(y);
+            const float xTopLeft = std::floor(x);
+            const float dy = y - yTopLeft;
+            const float dx = x - xTopLeft;
+            const auto y0 = static_cast<int64_t>(yTopLeft);
+            const auto x0 = static_cast<int64_t>(xTopLeft);
+            if (interpolationMode == InterpolationMode::Bilinear) {
+                setSample(y0, x0, (1.f - dy) * (1.f - dx), H, W, idx[0], wei[0]);
+                setSample(y0, x0 + 1, (1.f - dy) * dx, H, W, idx[1], wei[1]);
+                setSample(y0 + 1, x0, dy * (1.f - dx), H, W, idx[2], wei[2]);
+                setSample(y0 + 1, x0 + 1, dy * dx, H, W, idx[3], wei[3]);
+            } else {
+                float cy[4], cx[4];
+                cubicCoeffs(dy, cy);
+                cubicCoeffs(dx, cx);
+                for (int j = 0; j < 4; j++) {
+                    for (int i = 0; i < 4; i++) {
+                        setSample(y0 - 1 + j, x0 - 1 + i, cy[j] * cx[i], H, W, idx[j * 4 + i], wei[j * 4 + i]);
+                    }
+                }
+            }
+        }
+    });
+}
+
+void GridSample::execute(dnnl::stream strm) {
+    const auto& dataMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto& gridMemPtr = getParentEdgeAt(GRID_ID)->getMemoryPtr();
+    const auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+
+    const auto& dataDims = dataMemPtr->getStaticDims();
+    const auto& gridDims = gridMemPtr->getStaticDims();
+    const size_t N = dataDims[0];
+    const size_t C = dataDims[1];
+    const size_t H = dataDims[2];
+    const size_t W = dataDims[3];
+    const size_t points = gridDims[1] * gridDims[2];
+    if (H * W > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        IE_THROW() << errorPrefix << " has too large spatial dimensions of the data input";
+
+    const auto src = reinterpret_cast<const float*>(dataMemPtr->GetPtr());
+    const auto grid = reinterpret_cast<const float*>(gridMemPtr->GetPtr());
+    auto dst = reinterpret_cast<float*>(dstMemPtr->GetPtr());
+
+    prepareSamples(grid, N, H, W, points);
+
+    parallel_for3d(N, C, div_up(points, pointsBlock), [&](size_t n, size_t c, size_t block) {
+        const float* srcPlane = src + (n * C + c) * H * W;
+        float* dstPlane = dst + (n * C + c) * points;
+        const size_t pointsEnd = std::min(points, (block + 1) * pointsBlock);
+        for (size_t p = block * pointsBlock; p < pointsEnd; p++) {
+            const int32_t* idx = &indices[(n * points + p) * pointsPerSample];
+            const float* wei = &weights[(n * points + p) * pointsPerSample];
+            float sum = 0.f;
+            for (size_t k = 0; k < pointsPerSample; k++)
+                sum += srcPlane[idx[k]] * wei[k];
+            dstPlane[p] = sum;
+        }
+    });
+}
+
+void GridSample::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool GridSample::created() const {
+    return getType() == Type::GridSample;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
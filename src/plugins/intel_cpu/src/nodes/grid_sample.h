@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class GridSample : public Node {
+public:
+    GridSample(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+
+    bool needPrepareParams() const override { return false; }
+    void executeDynamicImpl(dnnl::stream strm) override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+    enum class InterpolationMode {
+        Bilinear,
+        Bicubic,
+        Nearest
+    };
+
+    enum class PaddingMode {
+        Zeros,
+        Border,
+        Reflection
+    };
+
+private:
+    // The source points and the weights are computed once per grid point and shared by all the channels:
+    // dst[n][c][p] = sum_k src[n][c][indices[k]] * weights[k], k = p * pointsPerSample .. (p + 1) * pointsPerSample - 1
+    void prepareSamples(const float* grid, size_t N, size_t H, size_t W, size_t points);
+    inline void setSample(int64_t y, int64_t x, float weight, size_t H, size_t W, int32_t& index, float& sampleWeight) const;
+
+    bool alignCorners = false;
+    InterpolationMode interpolationMode = InterpolationMode::Bilinear;
+    PaddingMode paddingMode = PaddingMode::Zeros;
+    size_t pointsPerSample = 4;
+
+    std::vector<int32_t> indices;
+    std::vector<float> weights;
+
+    std::string errorPrefix;
+
+    static constexpr size_t DATA_ID = 0;
+    static constexpr size_t GRID_ID = 1;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
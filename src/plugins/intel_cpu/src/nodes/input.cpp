@@ -14,6 +14,7 @@
 #include <ngraph/ops.hpp>
 #include <ie_parallel.hpp>
 #include <ie_ngraph_utils.hpp>
+#include <ie_system_conf.h>
 #include <blob_factory.hpp>
 #include "caseless.hpp"
 #include "common/cpu_memcpy.h"
@@ -350,10 +351,29 @@ void Input::cloneBlobIfRequired() {
                 + "_" + ptr;
     };
 
+    // The constant data can be used directly if the memory descriptor covers it (see CVS-74980 above)
+    // and no copy is required by the checks above
+    auto canShareData = [&, this] () {
+        return constOp->get_byte_size() >= memDesc.getCurrentMemSize() &&
+               isBlobAligned() && !hasSubnormals() && !isWA();
+    };
+
     if (weightCache) {
-        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        // The constant data (e.g. weights file pages mapped by the IR frontend) is used directly when possible,
+        // so all the streams of the same NUMA node share a single copy of the weights. The check is done by the
+        // builder, so the data is scanned only once for all the streams.
+        auto buildBlob = [&, this] () {
+            // the weights are replicated per NUMA node, the shared pages would be remote for all the nodes but one
+            if (InferenceEngine::getAvailableNUMANodes().size() <= 1 && canShareData()) {
+                MemoryPtr ptr = MemoryPtr(new Memory(getEngine()));
+                ptr->Create(memDesc, constOp->get_data_ptr());
+                return ptr;
+            }
+            return cloneBlob();
+        };
+        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), buildBlob);
         memoryPtr = std::const_pointer_cast<const Memory>(ptr);
-    } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
+    } else if (canShareData()) {
         auto ptr = new Memory(getEngine());
         ptr->Create(memDesc, constOp->get_data_ptr());
         memoryPtr = MemoryCPtr(ptr);
@@ -381,6 +401,13 @@ Input::Input(MemoryDescPtr memDesc, const std::string &name, const std::string &
     extMemDesc = memDesc;
 }
 
+Input::Input(MemoryCPtr mem, const std::string &name, const std::string &type,
+                                 const dnnl::engine &eng, WeightsSharing::Ptr &cache) :
+    Input(mem->getDesc().getShape(), mem->getDesc().getPrecision(), name, type, eng, cache) {
+    constant = ConstantType::Const;
+    memoryPtr = mem;
+}
+
 void Input::withMeanImage() {
     isMeanImage = true;
 }
@@ -20,6 +20,8 @@ public:
                     const std::string &type, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
     Input(MemoryDescPtr memDesc, const std::string &name, const std::string &type, const dnnl::engine& eng,
                     WeightsSharing::Ptr &cache);
+    Input(MemoryCPtr mem, const std::string &name, const std::string &type, const dnnl::engine& eng,
+                    WeightsSharing::Ptr &cache);
 
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
@@ -10,6 +10,7 @@
 #include <queue>
 
 #include "non_max_suppression.h"
+#include "common/nms_utils.h"
 #include "ie_parallel.hpp"
 #include <ngraph/opsets/opset5.hpp>
 #include <ngraph_ops/nms_ie_internal.hpp>
@@ -995,33 +996,30 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::vector<std::pair<float, int>> sorted_boxes;  // score, box_idx
-        for (int box_idx = 0; box_idx < numBoxes; box_idx++) {
-            if (scoresPtr[box_idx] > scoreThreshold)
-                sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-        }
+        std::vector<ScoredBox> candidates;  // score, box_idx
+        filterByScore(scoresPtr, static_cast<int>(numBoxes), scoreThreshold, false, candidates);
 
         int io_selection_size = 0;
-        size_t sortedBoxSize = sorted_boxes.size();
-        if (sortedBoxSize > 0) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
+        const size_t candidatesNum = candidates.size();
+        if (candidatesNum > 0) {
+            // the candidates are ordered lazily, the loops below usually stop long before all of them are visited
+            SortedCandidates sorted_boxes(candidates);
+            const auto first_box = sorted_boxes.next();
             int offset = batch_idx*numClasses*maxOutputBoxesPerClass + class_idx*maxOutputBoxesPerClass;
-            filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
+            filtBoxes[offset + 0] = filteredBoxes(first_box.first, batch_idx, class_idx, first_box.second);
             io_selection_size++;
-            if (sortedBoxSize > 1) {
+            if (candidatesNum > 1) {
                 if (nms_kernel) {
-                    std::vector<float> boxCoord0(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord1(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord2(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord3(sortedBoxSize, 0.0f);
+                    const size_t maxSelectedNum = std::min(candidatesNum, maxOutputBoxesPerClass);
+                    std::vector<float> boxCoord0(maxSelectedNum, 0.0f);
+                    std::vector<float> boxCoord1(maxSelectedNum, 0.0f);
+                    std::vector<float> boxCoord2(maxSelectedNum, 0.0f);
+                    std::vector<float> boxCoord3(maxSelectedNum, 0.0f);
 
-                    boxCoord0[0] = boxesPtr[sorted_boxes[0].second * 4];
-                    boxCoord1[0] = boxesPtr[sorted_boxes[0].second * 4 + 1];
-                    boxCoord2[0] = boxesPtr[sorted_boxes[0].second * 4 + 2];
-                    boxCoord3[0] = boxesPtr[sorted_boxes[0].second * 4 + 3];
+                    boxCoord0[0] = boxesPtr[first_box.second * 4];
+                    boxCoord1[0] = boxesPtr[first_box.second * 4 + 1];
+                    boxCoord2[0] = boxesPtr[first_box.second * 4 + 2];
+                    boxCoord3[0] = boxesPtr[first_box.second * 4 + 3];
 
                     auto arg = jit_nms_args();
                     arg.iou_threshold = static_cast<float*>(&iouThreshold);
@@ -1033,27 +1031,29 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
                     arg.selected_boxes_coord[2] = static_cast<float*>(&boxCoord2[0]);
                     arg.selected_boxes_coord[3] = static_cast<float*>(&boxCoord3[0]);
 
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
+                    while (!sorted_boxes.empty() && (io_selection_size < max_out_box)) {
+                        const auto candidate = sorted_boxes.next();
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
                         arg.selected_boxes_num = io_selection_size;
-                        arg.candidate_box = static_cast<const float*>(&boxesPtr[sorted_boxes[candidate_idx].second * 4]);
+                        arg.candidate_box = static_cast<const float*>(&boxesPtr[candidate.second * 4]);
                         arg.candidate_status = static_cast<int*>(&candidateStatus);
                         (*nms_kernel)(&arg);
                         if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            boxCoord0[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4];
-                            boxCoord1[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 1];
-                            boxCoord2[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 2];
-                            boxCoord3[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 3];
+                            boxCoord0[io_selection_size] = boxesPtr[candidate.second * 4];
+                            boxCoord1[io_selection_size] = boxesPtr[candidate.second * 4 + 1];
+                            boxCoord2[io_selection_size] = boxesPtr[candidate.second * 4 + 2];
+                            boxCoord3[io_selection_size] = boxesPtr[candidate.second * 4 + 3];
                             filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
+                                filteredBoxes(candidate.first, batch_idx, class_idx, candidate.second);
                             io_selection_size++;
                         }
                     }
                 } else {
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
+                    while (!sorted_boxes.empty() && (io_selection_size < max_out_box)) {
+                        const auto candidate = sorted_boxes.next();
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
                         for (int selected_idx = io_selection_size - 1; selected_idx >= 0; selected_idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[candidate_idx].second * 4],
+                            float iou = intersectionOverUnion(&boxesPtr[candidate.second * 4],
                                 &boxesPtr[filtBoxes[offset + selected_idx].box_index * 4]);
                             if (iou >= iouThreshold) {
                                 candidateStatus = NMSCandidateStatus::SUPPRESSED;
@@ -1063,7 +1063,7 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
 
                         if (candidateStatus == NMSCandidateStatus::SELECTED) {
                             filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
+                                filteredBoxes(candidate.first, batch_idx, class_idx, candidate.second);
                             io_selection_size++;
                         }
                     }
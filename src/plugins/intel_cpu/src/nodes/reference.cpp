@@ -8,6 +8,7 @@
 #include "openvino/runtime/tensor.hpp"
 #include "common/blocked_desc_creator.h"
 #include <ngraph/opsets/opset1.hpp>
+#include <chrono>
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -58,6 +59,8 @@ void Reference::initSupportedPrimitiveDescriptors() {
 void Reference::createPrimitive() {}
 
 void Reference::execute(dnnl::stream strm) {
+    const auto start = std::chrono::steady_clock::now();
+
     ov::TensorVector inputs;
     for (size_t i = 0; i < inputShapes.size(); i++) {
         void *srcDataPtr = getParentEdgesAtPort(i)[0]->getMemory().GetPtr();
@@ -75,6 +78,9 @@ void Reference::execute(dnnl::stream strm) {
     if (!ngraphOp->evaluate(outputs, inputs)) {
         IE_THROW() << "Evaluation failed on node of type: " << std::string(ngraphOp->get_type_name()) << " name: " << getName();
     }
+
+    execCount++;
+    execTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
 }
 
 std::vector<VectorDims> Reference::shapeInfer() const {
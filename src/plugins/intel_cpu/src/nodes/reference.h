@@ -5,6 +5,7 @@
 #pragma once
 
 #include <node.h>
+#include <atomic>
 
 namespace ov {
 namespace intel_cpu {
@@ -25,9 +26,24 @@ public:
     bool needPrepareParams() const override { return false; }
     void executeDynamicImpl(dnnl::stream strm) override;
 
+    std::string getOpTypeName() const {
+        return ngraphOp->get_type_name();
+    }
+    uint64_t getExecCount() const {
+        return execCount;
+    }
+    // in microseconds
+    uint64_t getExecTime() const {
+        return execTime;
+    }
+
 private:
     const std::shared_ptr<ngraph::Node> ngraphOp;
     const std::string additionalErrorMessage;
+
+    // the counters of the reference fallback statistics, they are read while the graph is executed
+    std::atomic<uint64_t> execCount{0};
+    std::atomic<uint64_t> execTime{0};
 };
 
 }   // namespace node
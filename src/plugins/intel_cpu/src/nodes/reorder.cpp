@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 #include <algorithm>
+#include <numeric>
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include "ie_parallel.hpp"
@@ -14,10 +15,16 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
 #include "convert.h"
+#include "emitters/jit_load_store_emitters.hpp"
 #include <common/primitive_hashing_utils.hpp>
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace dnnl;
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_reorder_transpose_call_args, field)
 
 namespace ov {
 namespace intel_cpu {
@@ -48,8 +55,181 @@ bool ReorderKey::operator==(const ReorderKey& rhs) const {
     return retVal;
 }
 
+struct ReorderTransposeKey {
+    jit_reorder_transpose_config_params jcp;
+
+    size_t hash() const;
+    bool operator==(const ReorderTransposeKey& rhs) const;
+};
+
+size_t ReorderTransposeKey::hash() const {
+    using namespace dnnl::impl;
+
+    size_t seed = 0;
+
+    seed = hash_combine(seed, jcp.src_prc.getPrecVal());
+    seed = hash_combine(seed, jcp.dst_prc.getPrecVal());
+    seed = hash_combine(seed, jcp.rows);
+    seed = hash_combine(seed, jcp.store_rows);
+    seed = hash_combine(seed, jcp.tail_cols);
+    return seed;
+}
+
+bool ReorderTransposeKey::operator==(const ReorderTransposeKey& rhs) const {
+    return jcp.src_prc == rhs.jcp.src_prc &&
+           jcp.dst_prc == rhs.jcp.dst_prc &&
+           jcp.rows == rhs.jcp.rows &&
+           jcp.store_rows == rhs.jcp.store_rows &&
+           jcp.tail_cols == rhs.jcp.tail_cols;
+}
+
+// the transposed block is 8x8 elements of 32 bits
+constexpr size_t transposeBlock = 8;
+// number of the columns processed by a single kernel call
+constexpr size_t transposeColumnsChunk = 16 * transposeBlock;
+
+bool isJitTransposeSupportedPrc(const Precision& prc) {
+    return one_of(prc, Precision::FP32, Precision::I32, Precision::I8, Precision::U8) ||
+           (prc == Precision::BF16 && mayiuse(avx512_core));
+}
+
 }  // namespace
 
+// The source rows are loaded with the conversion to FP32 (or I32 if both precisions are integer), transposed
+// as the 8x8 matrix of dwords and the columns are stored with the conversion to the destination precision,
+// so the layout change and the precision conversion take a single pass over the data.
+template <cpu_isa_t isa>
+struct jit_uni_reorder_transpose_kernel_f32 : public jit_uni_reorder_transpose_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reorder_transpose_kernel_f32)
+
+    explicit jit_uni_reorder_transpose_kernel_f32(jit_reorder_transpose_config_params jcp)
+        : jit_uni_reorder_transpose_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        const auto exec_prc = jcp_.src_prc.is_float() || jcp_.dst_prc.is_float() ? Precision::FP32 : Precision::I32;
+
+        load_emitter.reset(new jit_load_emitter(this, isa, jcp_.src_prc, exec_prc, transposeBlock));
+        store_emitter.reset(new jit_store_emitter(this, isa, exec_prc, jcp_.dst_prc, jcp_.store_rows));
+        if (jcp_.tail_cols != 0)
+            load_tail_emitter.reset(new jit_load_emitter(this, isa, jcp_.src_prc, exec_prc, jcp_.tail_cols));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+        mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        pool_gpr_idxs = {static_cast<size_t>(reg_aux0.getIdx()), static_cast<size_t>(reg_aux1.getIdx()),
+                         static_cast<size_t>(reg_aux2.getIdx())};
+        // the source rows are free after the transposition
+        store_pool_vec_idxs = {0, 1, 2};
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            worker(transposeBlock);
+
+            add(reg_src, static_cast<int>(transposeBlock * jcp_.src_prc.size()));
+            mov(reg_dst, reg_dst_col);
+            sub(reg_work_amount, 1);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        if (jcp_.tail_cols != 0)
+            worker(jcp_.tail_cols);
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+        if (load_tail_emitter)
+            load_tail_emitter->emit_data();
+    }
+
+private:
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_src_stride = r10;
+    Xbyak::Reg64 reg_dst_stride = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_src_row = r13;
+    Xbyak::Reg64 reg_dst_col = r14;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_aux0 = r15;
+    Xbyak::Reg64 reg_aux1 = rbp;
+    Xbyak::Reg64 reg_aux2 = rax;
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::unique_ptr<jit_load_emitter> load_tail_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+
+    std::vector<size_t> pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+
+    // Ymm(0) .. Ymm(7) hold the source rows, Ymm(8) .. Ymm(15) get the destination columns
+    inline void worker(size_t cols) {
+        const auto& load = cols == transposeBlock ? load_emitter : load_tail_emitter;
+
+        mov(reg_src_row, reg_src);
+        for (size_t r = 0; r < transposeBlock; r++) {
+            if (r < jcp_.rows) {
+                load->emit_code({static_cast<size_t>(reg_src_row.getIdx())}, {r}, {}, pool_gpr_idxs);
+                if (r + 1 < jcp_.rows)
+                    add(reg_src_row, reg_src_stride);
+            } else {
+                uni_vpxor(Ymm(r), Ymm(r), Ymm(r));
+            }
+        }
+
+        transpose_8x8();
+
+        mov(reg_dst_col, reg_dst);
+        for (size_t c = 0; c < cols; c++) {
+            store_emitter->emit_code({transposeBlock + c}, {static_cast<size_t>(reg_dst_col.getIdx())},
+                store_pool_vec_idxs, pool_gpr_idxs);
+            add(reg_dst_col, reg_dst_stride);
+        }
+    }
+
+    inline void transpose_8x8() {
+        auto row = [](size_t i) { return Ymm(i); };
+        auto tmp = [](size_t i) { return Ymm(transposeBlock + i); };
+
+        // interleave the pairs of the rows
+        for (size_t i = 0; i < transposeBlock; i += 2) {
+            vunpcklps(tmp(i), row(i), row(i + 1));
+            vunpckhps(tmp(i + 1), row(i), row(i + 1));
+        }
+        // gather the 4-row columns within the 128-bit lanes: the register 4 * j + k holds
+        // the columns k and k + 4 of the rows 4 * j .. 4 * j + 3
+        for (size_t j = 0; j < transposeBlock; j += 4) {
+            vshufps(row(j), tmp(j), tmp(j + 2), 0x44);
+            vshufps(row(j + 1), tmp(j), tmp(j + 2), 0xEE);
+            vshufps(row(j + 2), tmp(j + 1), tmp(j + 3), 0x44);
+            vshufps(row(j + 3), tmp(j + 1), tmp(j + 3), 0xEE);
+        }
+        // merge the lanes of the upper and the lower rows
+        for (size_t k = 0; k < 4; k++) {
+            vperm2f128(tmp(k), row(k), row(k + 4), 0x20);
+            vperm2f128(tmp(k + 4), row(k), row(k + 4), 0x31);
+        }
+    }
+};
+
 bool Reorder::isExecutable() const {
     return Node::isExecutable() && !isOptimized;
 }
@@ -165,6 +345,11 @@ void Reorder::prepareParams() {
 
         const auto&  parentDesc = srcMemPtr->getDesc();
         const auto&  childDesc = dstMemPtr->getDesc();
+        canUseJitTranspose = isSupportedDesc(childDesc) && isSupportedDesc(parentDesc) &&
+                             prepareJitTranspose(parentDesc, childDesc);
+        if (canUseJitTranspose)
+            return;
+
         if ((isNspc2NcspCase || isNcsp2NspcCase) && isSupportedDesc(childDesc) && isSupportedDesc(parentDesc)) {
             const auto &inDims = srcMemPtr->getStaticDims();
             // Check that child strides are consistent with parent dims if the child is inplace.
@@ -284,6 +469,191 @@ void Reorder::createReorderPrimitive(const dnnl::memory::desc& srcDesc,
     primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}};
 }
 
+bool Reorder::prepareJitTranspose(const MemoryDesc& parentDesc, const MemoryDesc& childDesc) {
+    if (!mayiuse(avx2) || !src_permutation.empty())
+        return false;
+    if (!isJitTransposeSupportedPrc(parentDesc.getPrecision()) || !isJitTransposeSupportedPrc(childDesc.getPrecision()))
+        return false;
+
+    const auto& dims = parentDesc.getShape().getStaticDims();
+    const size_t rank = dims.size();
+    if (!one_of(rank, 3, 4, 5) || childDesc.getShape().getStaticDims() != dims)
+        return false;
+
+    const auto srcDesc = parentDesc.as<BlockedMemoryDesc>();
+    const auto dstDesc = childDesc.as<BlockedMemoryDesc>();
+    for (const auto desc : {srcDesc, dstDesc}) {
+        const auto& offsets = desc->getOffsetPaddingToData();
+        if (desc->getOffsetPadding() != 0 || std::any_of(offsets.begin(), offsets.end(), [](size_t offset) { return offset != 0; }))
+            return false;
+    }
+
+    // the spatial dims of the blocked dims [first, last] have to be dense, so they are a single dim of the transpose
+    auto spatialIsDense = [](const BlockedMemoryDesc* desc, size_t first, size_t last) {
+        const auto& strides = desc->getStrides();
+        const auto& blockedDims = desc->getBlockDims();
+        for (size_t i = first; i < last; i++) {
+            if (strides[i] != strides[i + 1] * blockedDims[i + 1])
+                return false;
+        }
+        return true;
+    };
+    auto blockSize = [](const MemoryDesc& desc) -> size_t {
+        if (desc.hasLayoutType(LayoutType::nCsp8c))
+            return 8;
+        if (desc.hasLayoutType(LayoutType::nCsp16c))
+            return 16;
+        return 0;
+    };
+
+    const size_t C = dims[1];
+    const size_t S = std::accumulate(dims.begin() + 2, dims.end(), size_t{1}, std::multiplies<size_t>());
+    const size_t srcPrcSize = parentDesc.getPrecision().size();
+    const size_t dstPrcSize = childDesc.getPrecision().size();
+    const auto& srcStrides = srcDesc->getStrides();
+    const auto& dstStrides = dstDesc->getStrides();
+
+    TransposeParams params;
+    params.batch = dims[0];
+    params.srcBatchStride = srcStrides[0] * srcPrcSize;
+    params.dstBatchStride = dstStrides[0] * dstPrcSize;
+
+    const bool srcIsPlain = parentDesc.hasLayoutType(LayoutType::ncsp);
+    const bool dstIsPlain = childDesc.hasLayoutType(LayoutType::ncsp);
+    if (srcIsPlain && (childDesc.hasLayoutType(LayoutType::nspc) || blockSize(childDesc))) {
+        // the source rows are the channels
+        if (srcStrides.back() != 1 || !spatialIsDense(srcDesc, 2, rank - 1))
+            return false;
+        params.srcRowStride = srcStrides[1] * srcPrcSize;
+
+        const size_t block = blockSize(childDesc);
+        if (block == 0) {
+            // blocked dims: N, spatial..., C
+            if (dstStrides.back() != 1 || !spatialIsDense(dstDesc, 1, rank - 2))
+                return false;
+            params.dstRowStride = dstStrides[rank - 2] * dstPrcSize;
+            params.groups.push_back({0, 0, C, S});
+        } else {
+            // blocked dims: N, C / block, spatial..., block
+            if (dstStrides.back() != 1 || !spatialIsDense(dstDesc, 2, rank - 1))
+                return false;
+            params.dstRowStride = dstStrides[rank - 1] * dstPrcSize;
+            params.padRows = true;
+            const size_t paddedC = dstDesc->getBlockDims()[1] * block;
+            for (size_t c = 0; c < paddedC; c += transposeBlock) {
+                params.groups.push_back({c * srcStrides[1] * srcPrcSize,
+                                         ((c / block) * dstStrides[1] + c % block) * dstPrcSize,
+                                         c < C ? std::min(transposeBlock, C - c) : 0,
+                                         S});
+            }
+        }
+    } else if (dstIsPlain && (parentDesc.hasLayoutType(LayoutType::nspc) || blockSize(parentDesc))) {
+        // the source rows are the spatial points
+        if (dstStrides.back() != 1 || !spatialIsDense(dstDesc, 2, rank - 1))
+            return false;
+        params.dstRowStride = dstStrides[1] * dstPrcSize;
+
+        const size_t block = blockSize(parentDesc);
+        if (block == 0) {
+            if (srcStrides.back() != 1 || !spatialIsDense(srcDesc, 1, rank - 2))
+                return false;
+            params.srcRowStride = srcStrides[rank - 2] * srcPrcSize;
+            params.groups.push_back({0, 0, S, C});
+        } else {
+            if (srcStrides.back() != 1 || !spatialIsDense(srcDesc, 2, rank - 1))
+                return false;
+            params.srcRowStride = srcStrides[rank - 1] * srcPrcSize;
+            for (size_t c = 0; c < C; c += transposeBlock) {
+                params.groups.push_back({((c / block) * srcStrides[1] + c % block) * srcPrcSize,
+                                         c * dstStrides[1] * dstPrcSize,
+                                         S,
+                                         std::min(transposeBlock, C - c)});
+            }
+        }
+    } else {
+        return false;
+    }
+
+    auto builder = [](const ReorderTransposeKey& key) -> std::shared_ptr<jit_uni_reorder_transpose_kernel> {
+        std::shared_ptr<jit_uni_reorder_transpose_kernel> kernel;
+        if (mayiuse(avx512_core)) {
+            kernel.reset(new jit_uni_reorder_transpose_kernel_f32<avx512_core>(key.jcp));
+        } else if (mayiuse(avx2)) {
+            kernel.reset(new jit_uni_reorder_transpose_kernel_f32<avx2>(key.jcp));
+        }
+        if (kernel)
+            kernel->create_ker();
+        return kernel;
+    };
+
+    // the graph cache keeps the statistics, the kernels themselves are shared by the whole process
+    auto sharedBuilder = [&builder](const ReorderTransposeKey& key) {
+        return getJitKernelsCache().getOrCreate(key, builder).first;
+    };
+
+    jit_reorder_transpose_config_params jcp;
+    jcp.src_prc = parentDesc.getPrecision();
+    jcp.dst_prc = childDesc.getPrecision();
+
+    auto cache = getRuntimeCache();
+    params.kernels.resize((transposeBlock + 1) * transposeBlock);
+    for (const auto& group : params.groups) {
+        const std::vector<size_t> blockRows = params.padRows ? std::vector<size_t>{group.rows}
+                                                             : std::vector<size_t>{transposeBlock, group.rows % transposeBlock};
+        for (auto rows : blockRows) {
+            for (auto tailCols : {size_t{0}, group.cols % transposeBlock}) {
+                auto& kernel = params.kernels[rows * transposeBlock + tailCols];
+                if (kernel || (rows == 0 && !params.padRows))
+                    continue;
+                jcp.rows = rows;
+                jcp.store_rows = params.padRows ? transposeBlock : rows;
+                jcp.tail_cols = tailCols;
+                kernel = cache->getOrCreate(ReorderTransposeKey{jcp}, sharedBuilder).first;
+                if (!kernel)
+                    return false;
+            }
+        }
+    }
+
+    transposeParams = std::move(params);
+    supportedPrimitiveDescriptors[0].setImplementationType(mayiuse(avx512_core) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2);
+    return true;
+}
+
+void Reorder::jitTranspose() {
+    const auto& params = transposeParams;
+    const auto src = static_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    auto dst = static_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const size_t srcPrcSize = getParentEdgeAt(0)->getMemory().getDesc().getPrecision().size();
+    const size_t dstPrcSize = getChildEdgeAt(0)->getMemory().getDesc().getPrecision().size();
+
+    // the legacy dynamic batch limits the number of the processed batches
+    const size_t batch = isDynamicNode() ? params.batch : std::min<size_t>(params.batch, batchToProcess());
+    size_t rowBlocks = 1, colChunks = 1;
+    for (const auto& group : params.groups) {
+        rowBlocks = std::max(rowBlocks, params.padRows ? 1 : div_up(group.rows, transposeBlock));
+        colChunks = std::max(colChunks, div_up(group.cols, transposeColumnsChunk));
+    }
+
+    parallel_for4d(batch, params.groups.size(), rowBlocks, colChunks, [&](size_t b, size_t g, size_t rb, size_t cb) {
+        const auto& group = params.groups[g];
+        const size_t row = rb * transposeBlock;
+        const size_t col = cb * transposeColumnsChunk;
+        if ((row >= group.rows && !params.padRows) || col >= group.cols)
+            return;
+        const size_t rows = params.padRows ? group.rows : std::min(transposeBlock, group.rows - row);
+        const size_t cols = std::min(transposeColumnsChunk, group.cols - col);
+
+        auto args = jit_reorder_transpose_call_args();
+        args.src = src + b * params.srcBatchStride + group.srcOffset + row * params.srcRowStride + col * srcPrcSize;
+        args.dst = dst + b * params.dstBatchStride + group.dstOffset + col * params.dstRowStride + row * dstPrcSize;
+        args.src_stride = params.srcRowStride;
+        args.dst_stride = params.dstRowStride;
+        args.work_amount = cols / transposeBlock;
+        (*params.kernels[rows * transposeBlock + cols % transposeBlock])(&args);
+    });
+}
+
 const std::vector<impl_desc_type>& Reorder::getPrimitivesPriority() {
     implPriorities = {impl_desc_type::reorder};
     return implPriorities;
@@ -365,7 +735,9 @@ void Reorder::execute(dnnl::stream strm) {
         return;
     }
 
-    if (canUseNspc2Ncsp) {
+    if (canUseJitTranspose) {
+        jitTranspose();
+    } else if (canUseNspc2Ncsp) {
         optimizedNspc2Ncsp();
     } else if (canUseNcsp2Nspc) {
         optimizedNcsp2Nspc();
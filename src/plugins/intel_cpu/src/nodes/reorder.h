@@ -15,6 +15,41 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+struct jit_reorder_transpose_config_params {
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision dst_prc;
+    size_t rows;            // number of the loaded source rows (0 .. 8), the missing rows are zeroed
+    size_t store_rows;      // number of the elements stored per destination row (rows .. 8)
+    size_t tail_cols;       // number of the columns in the last tile (0 .. 7)
+};
+
+struct jit_reorder_transpose_call_args {
+    const void *src;
+    void *dst;
+    size_t src_stride;      // in bytes
+    size_t dst_stride;      // in bytes
+    size_t work_amount;     // number of the full 8-column tiles
+};
+
+// Transposes jcp_.rows source rows with the precision conversion on the fly: dst[c][r] = src[r][c].
+// The columns are processed by 8-column tiles followed by the jcp_.tail_cols tile, each destination row
+// gets jcp_.store_rows elements, so the channel blocks of the blocked layouts are padded with zeros.
+struct jit_uni_reorder_transpose_kernel {
+    void (*ker_)(const jit_reorder_transpose_call_args *);
+
+    void operator()(const jit_reorder_transpose_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_reorder_transpose_kernel(jit_reorder_transpose_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_reorder_transpose_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_reorder_transpose_config_params jcp_;
+};
+
 class Reorder : public Node {
 public:
     Reorder(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
@@ -54,6 +89,10 @@ public:
         this->isOptimized = isOptimized;
     }
 
+    bool getOptimized() const {
+        return isOptimized;
+    }
+
     void setDynamicBatchLim(int lim) override;
 
     bool canBeInPlace() const override {
@@ -83,6 +122,32 @@ private:
     bool canUseNspc2Ncsp = false;
     bool canUseNcsp2Nspc = false;
 
+    // The plain <-> channels last and the plain <-> blocked reorders are performed as the 2D transposes
+    // of the channels and the spatial dims, every 8-channel slice of a block is a separate group.
+    struct TransposeGroup {
+        size_t srcOffset;       // in bytes
+        size_t dstOffset;       // in bytes
+        size_t rows;
+        size_t cols;
+    };
+
+    struct TransposeParams {
+        size_t batch = 0;
+        size_t srcBatchStride = 0;     // in bytes
+        size_t dstBatchStride = 0;     // in bytes
+        size_t srcRowStride = 0;       // in bytes
+        size_t dstRowStride = 0;       // in bytes
+        bool padRows = false;
+        std::vector<TransposeGroup> groups;
+        // indexed by the number of the source rows and the tail columns of a block
+        std::vector<std::shared_ptr<jit_uni_reorder_transpose_kernel>> kernels;
+    };
+
+    bool canUseJitTranspose = false;
+    TransposeParams transposeParams;
+
+    bool prepareJitTranspose(const MemoryDesc& parentDesc, const MemoryDesc& childDesc);
+    void jitTranspose();
     void optimizedNspc2Ncsp();
     void optimizedNcsp2Nspc();
     void createReorderPrimitive(const dnnl::memory::desc &srcDesc, void* srcPtr, const dnnl::memory::desc &dstDesc, void* dstPtr);
@@ -5,15 +5,31 @@
 #include "softmax.h"
 
 #include <string>
+#include <cfloat>
+#include <numeric>
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include <ngraph/opsets/opset1.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_hashing_utils.hpp>
+#include "fake_quantize.h"
+#include "eltwise.h"
+#include "ie_parallel.hpp"
+#include "emitters/jit_load_store_emitters.hpp"
+
+#include <cpu/x64/jit_generator.hpp>
+#include <cpu/x64/injectors/jit_uni_depthwise_injector.hpp>
+#include <cpu/x64/injectors/jit_uni_quantization_injector.hpp>
+#include <cpu/x64/injectors/jit_uni_eltwise_injector.hpp>
 
 using namespace dnnl;
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
+using namespace dnnl::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_softmax_fused_call_args, field)
 
 namespace ov {
 namespace intel_cpu {
@@ -51,8 +67,288 @@ bool SoftmaxKey::operator==(const SoftmaxKey& rhs) const {
     return retVal;
 }
 
+struct SoftmaxFusedKey {
+    jit_softmax_fused_config_params jcp;
+    dnnl::primitive_attr attr;
+
+    size_t hash() const;
+    bool operator==(const SoftmaxFusedKey& rhs) const;
+};
+
+size_t SoftmaxFusedKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+
+    seed = hash_combine(seed, jcp.src_prc.getPrecVal());
+    seed = hash_combine(seed, jcp.dst_prc.getPrecVal());
+    seed = hash_combine(seed, jcp.work_amount);
+    seed = hash_combine(seed, get_attr_hash(*attr.get()));
+    return seed;
+}
+
+bool SoftmaxFusedKey::operator==(const SoftmaxFusedKey& rhs) const {
+    return jcp.src_prc == rhs.jcp.src_prc &&
+           jcp.dst_prc == rhs.jcp.dst_prc &&
+           jcp.work_amount == rhs.jcp.work_amount &&
+           *attr.get() == *rhs.attr.get();
+}
+
 }  // namespace
 
+// Softmax along the innermost axis of a planar tensor, processes a single row per call:
+// the row maximum, the sum of exp(x - max) and the normalized values with the fused post ops applied.
+// The exponents are recomputed on the last pass, so the destination may have any precision the post ops produce.
+template <cpu_isa_t isa>
+struct jit_uni_softmax_fused_kernel_f32 : public jit_uni_softmax_fused_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_softmax_fused_kernel_f32)
+
+    explicit jit_uni_softmax_fused_kernel_f32(jit_softmax_fused_config_params jcp, const dnnl_primitive_attr &attr)
+        : jit_uni_softmax_fused_kernel(jcp, attr), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        const auto &p = attr_.post_ops_;
+        for (int i = 0; i < p.len(); i++) {
+            auto &post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors.push_back(std::make_shared<jit_uni_eltwise_injector_f32<isa>>(
+                        this, post_op.eltwise.alg, post_op.eltwise.alpha, post_op.eltwise.beta, post_op.eltwise.scale));
+            } else if (post_op.is_depthwise()) {
+                depthwise_injectors.push_back(std::make_shared<jit_uni_depthwise_injector_f32<isa>>(
+                        this, post_op));
+            } else if (post_op.is_quantization()) {
+                quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
+                        this, post_op, vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
+            }
+        }
+        exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, dnnl::impl::alg_kind::eltwise_exp, 0.f, 0.f, 1.0f));
+
+        tail_step = jcp_.work_amount % vector_step;
+
+        load_vector_emitter.reset(new jit_load_emitter(this, isa, jcp_.src_prc, Precision::FP32, vector_step));
+        store_vector_emitter.reset(new jit_store_emitter(this, isa, Precision::FP32, jcp_.dst_prc, vector_step));
+        if (tail_step != 0) {
+            // the lanes out of the row are filled with the lowest value, so they change neither the maximum nor the sum
+            load_tail_emitter.reset(new jit_load_emitter(this, isa, jcp_.src_prc, Precision::FP32, tail_step,
+                                                         Precision::FP32, true, "float_min"));
+            store_tail_emitter.reset(new jit_store_emitter(this, isa, Precision::FP32, jcp_.dst_prc, tail_step));
+        }
+
+        this->preamble();
+
+        mov(reg_post_ops_data, ptr[reg_params + GET_OFF(post_op_data)]);
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_oc_off, ptr[reg_params + GET_OFF(oc_off)]);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_aux.getIdx()), static_cast<size_t>(vmm_val.getIdx())};
+
+        mov(reg_tmp.cvt32(), float2int(-FLT_MAX));
+        uni_vmovd(Xmm(vmm_max.getIdx()), reg_tmp.cvt32());
+        uni_vbroadcastss(vmm_max, Xmm(vmm_max.getIdx()));
+        worker_row(pass_kind::max);
+        horizontal_reduce(vmm_max, pass_kind::max);
+
+        uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+        worker_row(pass_kind::sum);
+        horizontal_reduce(vmm_sum, pass_kind::sum);
+
+        mov(reg_tmp.cvt32(), float2int(1.0f));
+        uni_vmovd(Xmm(vmm_aux.getIdx()), reg_tmp.cvt32());
+        uni_vbroadcastss(vmm_aux, Xmm(vmm_aux.getIdx()));
+        uni_vdivps(vmm_aux, vmm_aux, vmm_sum);
+        uni_vmovups(vmm_sum, vmm_aux);
+        worker_row(pass_kind::normalize);
+
+        this->postamble();
+
+        load_vector_emitter->emit_data();
+        store_vector_emitter->emit_data();
+        if (tail_step != 0) {
+            load_tail_emitter->emit_data();
+            store_tail_emitter->emit_data();
+        }
+
+        exp_injector->prepare_table();
+        for (auto& inj : eltwise_injectors)
+            inj->prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == sse41, Xbyak::Xmm, isa == avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    enum class pass_kind { max, sum, normalize };
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int vector_step = vlen / sizeof(float);
+    size_t tail_step = 0;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_src_aux = r10;
+    Xbyak::Reg64 reg_dst_aux = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_oc_off = r13;
+    Xbyak::Reg64 reg_tmp = r14;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_d_weights = rbx;
+    Xbyak::Reg64 reg_d_bias = rdx;
+    Xbyak::Reg64 reg_post_ops_data = rsi;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_store_mask = rbp;
+
+    Vmm vmm_max = Vmm(0);
+    Vmm vmm_val = Vmm(1);
+    Vmm vmm_sum = Vmm(2);
+    Vmm vmm_aux = Vmm(3);
+
+    Vmm vmm_d_weights = Vmm(5);
+    Vmm vmm_d_bias = Vmm(6);
+
+    std::unique_ptr<jit_load_emitter> load_vector_emitter = nullptr;
+    std::unique_ptr<jit_load_emitter> load_tail_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_vector_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_tail_emitter = nullptr;
+
+    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
+    std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_depthwise_injector_f32<isa>>> depthwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_quantization_injector_f32<isa>>> quantization_injectors;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    inline void worker(pass_kind pass, bool is_tail) {
+        const auto& load_emitter = is_tail ? load_tail_emitter : load_vector_emitter;
+        load_emitter->emit_code({static_cast<size_t>(reg_src_aux.getIdx())}, {static_cast<size_t>(vmm_val.getIdx())},
+            {}, {load_pool_gpr_idxs});
+
+        if (pass == pass_kind::max) {
+            uni_vmaxps(vmm_max, vmm_max, vmm_val);
+            return;
+        }
+
+        uni_vsubps(vmm_val, vmm_val, vmm_max);
+        exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+        if (pass == pass_kind::sum) {
+            uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+            return;
+        }
+
+        uni_vmulps(vmm_val, vmm_val, vmm_sum);
+        apply_post_ops(jcp_.dst_prc);
+
+        const auto& store_emitter = is_tail ? store_tail_emitter : store_vector_emitter;
+        store_emitter->emit_code({static_cast<size_t>(vmm_val.getIdx())}, {static_cast<size_t>(reg_dst_aux.getIdx())},
+            {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+    }
+
+    inline void worker_row(pass_kind pass) {
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        mov(reg_src_aux, reg_src);
+        mov(reg_dst_aux, reg_dst);
+        mov(reg_work_amount, jcp_.work_amount / vector_step);
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            worker(pass, false);
+
+            add(reg_src_aux, static_cast<int>(vector_step * jcp_.src_prc.size()));
+            add(reg_dst_aux, static_cast<int>(vector_step * jcp_.dst_prc.size()));
+            sub(reg_work_amount, 1);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        if (tail_step != 0)
+            worker(pass, true);
+    }
+
+    // reduces the vector lanes with max or add and broadcasts the result back to all the lanes
+    inline void horizontal_reduce(const Vmm &vmm, pass_kind pass) {
+        auto reduce = [&](const Xbyak::Xmm &dst, const Xbyak::Operand &src) {
+            if (pass == pass_kind::max)
+                uni_vmaxps(dst, dst, src);
+            else
+                uni_vaddps(dst, dst, src);
+        };
+
+        const Xbyak::Xmm xmm = Xbyak::Xmm(vmm.getIdx());
+        const Xbyak::Xmm xmm_aux = Xbyak::Xmm(vmm_aux.getIdx());
+        if (isa == avx512_core) {
+            vextractf64x4(Xbyak::Ymm(vmm_aux.getIdx()), Xbyak::Zmm(vmm.getIdx()), 1);
+            reduce(Xbyak::Ymm(vmm.getIdx()), Xbyak::Ymm(vmm_aux.getIdx()));
+        }
+        if (isa != sse41) {
+            vextractf128(xmm_aux, Xbyak::Ymm(vmm.getIdx()), 1);
+            reduce(xmm, xmm_aux);
+        }
+        uni_vmovshdup(xmm_aux, xmm);        //  v:1,2,3,4; aux:2,2,4,4
+        reduce(xmm, xmm_aux);               //  v:1~2,2~2,3~4,4~4
+        uni_vmovhlps(xmm_aux, xmm_aux, xmm); //  aux:3~4,4~4,4,4
+        reduce(xmm, xmm_aux);               //  v:1~2~3~4,...
+        uni_vbroadcastss(vmm, xmm);
+    }
+
+    void apply_post_ops(InferenceEngine::Precision dst_prc) {
+        const auto &p = attr_.post_ops_;
+        int eltwise_inj_idx = 0;
+        int depthwise_inj_idx = 0;
+        int quantization_inj_idx = 0;
+        int post_ops_data_offset = 0;
+        for (int i = 0; i < p.len(); i++) {
+            auto& post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors[eltwise_inj_idx]->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+                eltwise_inj_idx++;
+            } else if (post_op.is_depthwise()) {
+                mov(reg_d_weights, ptr[reg_post_ops_data + post_ops_data_offset]);
+                add(reg_d_weights, reg_oc_off);
+
+                depthwise_injectors[depthwise_inj_idx]->compute_vector_range(
+                        vmm_val.getIdx(), vmm_val.getIdx() + 1, reg_d_weights, reg_d_weights, true);
+
+                post_ops_data_offset += depthwise_injectors[depthwise_inj_idx]->memoryStep();
+                depthwise_inj_idx++;
+            } else if (post_op.is_quantization()) {
+                bool do_dequantization = post_op.quantization.alg == dnnl::impl::alg_kind::quantization_quantize_dequantize;
+                bool do_rounding = do_dequantization || one_of(dst_prc, Precision::FP32, Precision::BF16) || i != p.len() - 1;
+                int s_idx = vmm_val.getIdx();
+
+                quantization_injectors[quantization_inj_idx]->init_crop_ptrs(reg_post_ops_data + post_ops_data_offset, reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_crop(s_idx, s_idx + 1, 0, 0, true);
+
+                quantization_injectors[quantization_inj_idx]->init_input_scale_shift_ptrs(reg_post_ops_data + post_ops_data_offset, reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_input_scale_shift(s_idx, s_idx + 1, 0, do_rounding, 0, true);
+
+                quantization_injectors[quantization_inj_idx]->init_output_scale_shift_ptrs(reg_post_ops_data + post_ops_data_offset, reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_output_scale_shift(s_idx, s_idx + 1, 0, 0, true);
+
+                post_ops_data_offset += quantization_injectors[quantization_inj_idx]->memoryStep();
+                quantization_inj_idx++;
+            }
+        }
+    }
+};
+
 bool SoftMax::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!std::dynamic_pointer_cast<const ngraph::opset1::Softmax>(op)) {
@@ -75,7 +371,8 @@ SoftMax::SoftMax(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& en
 }
 
 void SoftMax::getSupportedDescriptors() {
-    if (descs.size())
+    // the node with fused consumers is executed by the own JIT kernel, see initSupportedPrimitiveDescriptors()
+    if (descs.size() || !fusedWith.empty())
         return;
 
     InferenceEngine::Precision precision = getOriginalInputPrecisionAtPort(0);
@@ -108,11 +405,67 @@ bool SoftMax::created() const {
     return getType() == Type::Softmax;
 }
 
+bool SoftMax::canFuse(const NodePtr& node) const {
+    // Only the softmax along the innermost axis has the JIT implementation applying the post ops. The channel axis
+    // must differ from the softmax one, so that the per channel post ops data is broadcasted along the processed row.
+    const auto rank = getInputShapeAtPort(0).getRank();
+    if (!mayiuse(sse41) || rank < 3 || axis != rank - 1)
+        return false;
+    if (!one_of(getOriginalInputPrecisionAtPort(0), Precision::FP32, Precision::BF16))
+        return false;
+
+    return canFuseSimpleOperation(node);
+}
+
+void SoftMax::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    if (fusedWith.empty()) {
+        Node::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    Precision inputPrecision = getOriginalInputPrecisionAtPort(0);
+    Precision outputPrecision = fusedWith[fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(0);
+    if (!mayiuse(avx512_core)) {
+        if (inputPrecision == Precision::BF16)
+            inputPrecision = Precision::FP32;
+        if (outputPrecision == Precision::BF16)
+            outputPrecision = Precision::FP32;
+    }
+
+    impl_desc_type impl_type;
+    if (mayiuse(avx512_core)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else {
+        impl_type = impl_desc_type::jit_sse42;
+    }
+
+    addSupportedPrimDesc({{LayoutType::ncsp, inputPrecision}},
+                         {{LayoutType::ncsp, outputPrecision}},
+                         impl_type);
+}
+
 void SoftMax::initOptimalPrimitiveDescriptor() {
     auto selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set.";
     auto config = selected_pd->getConfig();
+    if (!fusedWith.empty()) {
+        // the input and output precisions differ when the post ops are fused, and there is no oneDNN descriptor to init
+        if (isDynamicNode()) {
+            auto outMemDesc = config.outConfs[0].getMemDesc();
+            config.outConfs[0].setMemDesc(std::dynamic_pointer_cast<BlockedMemoryDesc>(outMemDesc), BLOCKED_DESC_FULL_MASK);
+        } else {
+            config.inConfs[0].setMemDesc(getConsistentInputDesc(config, 0)->getMemDesc());
+            config.outConfs[0].setMemDesc(getConsistentOutputDesc(config, 0)->getMemDesc());
+        }
+        selected_pd->setConfig(config);
+        return;
+    }
     if (isDynamicNode()) {
         auto outMemDesc = config.outConfs[0].getMemDesc();
         config.outConfs[0].setMemDesc(std::dynamic_pointer_cast<BlockedMemoryDesc>(outMemDesc), BLOCKED_DESC_FULL_MASK);
@@ -140,6 +493,11 @@ void SoftMax::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
 }
 
 void SoftMax::prepareParams() {
+    if (!fusedWith.empty()) {
+        prepareFusedParams();
+        return;
+    }
+
     auto inpDesc = getParentEdgeAt(0)->getMemory().GetDescWithType<DnnlMemoryDesc>();
     const NodeDesc* selected_pd = getSelectedPrimitiveDescriptor();
 
@@ -185,6 +543,101 @@ void SoftMax::prepareParams() {
     primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}};
 }
 
+void SoftMax::prepareFusedParams() {
+    const auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    const auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->isAllocated())
+        IE_THROW() << "Destination memory didn't allocate for node " << getName() << ".";
+    if (!srcMemPtr || !srcMemPtr->isAllocated())
+        IE_THROW() << "Input memory didn't allocate for node " << getName() << ".";
+    const NodeDesc* selected_pd = getSelectedPrimitiveDescriptor();
+    if (selected_pd == nullptr)
+        IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
+
+    const auto& dims = srcMemPtr->getStaticDims();
+    SoftmaxFusedKey key = {{selected_pd->getConfig().inConfs[0].getMemDesc()->getPrecision(),
+                            selected_pd->getConfig().outConfs[0].getMemDesc()->getPrecision(),
+                            dims.back()},
+                           dnnl::primitive_attr()};
+    setPostOps(key.attr, dims);
+
+    auto builder = [](const SoftmaxFusedKey& key) -> std::shared_ptr<jit_uni_softmax_fused_kernel> {
+        std::shared_ptr<jit_uni_softmax_fused_kernel> kernel;
+        if (mayiuse(avx512_core)) {
+            kernel.reset(new jit_uni_softmax_fused_kernel_f32<avx512_core>(key.jcp, *key.attr.get()));
+        } else if (mayiuse(avx2)) {
+            kernel.reset(new jit_uni_softmax_fused_kernel_f32<avx2>(key.jcp, *key.attr.get()));
+        } else if (mayiuse(sse41)) {
+            kernel.reset(new jit_uni_softmax_fused_kernel_f32<sse41>(key.jcp, *key.attr.get()));
+        }
+        if (kernel)
+            kernel->create_ker();
+        return kernel;
+    };
+
+    auto cache = getRuntimeCache();
+    auto result = cache->getOrCreate(key, builder);
+    if (!result.first) {
+        IE_THROW() << "Can't create the softmax kernel with fused post ops for node " << getName() << ".";
+    }
+    fusedKernel = result.first;
+}
+
+void SoftMax::setPostOps(dnnl::primitive_attr &attr, const VectorDims &dims) {
+    dnnl::post_ops ops;
+
+    postOpsDataPtrs.clear();
+    for (auto &node : fusedWith) {
+        auto* fakeQuantizeNode = dynamic_cast<FakeQuantize *>(node.get());
+        if (fakeQuantizeNode) {
+            fakeQuantizeNode->appendPostOps(ops, {}, postOpsDataPtrs);
+            continue;
+        }
+
+        auto* eltwiseNode = dynamic_cast<Eltwise *>(node.get());
+        if (eltwiseNode) {
+            eltwiseNode->appendPostOps(ops, dims, postOpsDataPtrs);
+            continue;
+        }
+        IE_THROW() << "Fusing of " << NameFromType(node->getType()) << " operation to " << NameFromType(this->getType()) << " node is not implemented";
+    }
+    attr.set_post_ops(ops);
+}
+
+void SoftMax::execute(dnnl::stream strm) {
+    if (fusedWith.empty()) {
+        Node::execute(strm);
+        return;
+    }
+
+    if (!fusedKernel) {
+        IE_THROW() << "Can't execute Softmax node " << getName() << ". Kernel didn't created";
+    }
+    auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto *src_data = reinterpret_cast<const uint8_t*>(srcMemPtr->GetPtr());
+    auto *dst_data = reinterpret_cast<uint8_t*>(dstMemPtr->GetPtr());
+
+    const auto& dims = srcMemPtr->getStaticDims();
+    const size_t rowSize = dims.back();
+    const size_t channels = dims[1];
+    const size_t rowsPerChannel = std::accumulate(dims.begin() + 2, dims.end() - 1, size_t(1), std::multiplies<size_t>());
+    const size_t rows = dims[0] * channels * rowsPerChannel;
+    if (rowSize == 0)
+        return;
+
+    const size_t srcRowStride = rowSize * fusedKernel->jcp_.src_prc.size();
+    const size_t dstRowStride = rowSize * fusedKernel->jcp_.dst_prc.size();
+    parallel_for(rows, [&](size_t row) {
+        auto arg = jit_softmax_fused_call_args();
+        arg.src = src_data + row * srcRowStride;
+        arg.dst = dst_data + row * dstRowStride;
+        arg.oc_off = ((row / rowsPerChannel) % channels) * sizeof(float);
+        arg.post_op_data = postOpsDataPtrs.data();
+        (*fusedKernel)(&arg);
+    });
+}
+
 void SoftMax::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
@@ -14,24 +14,65 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+struct jit_softmax_fused_config_params {
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision dst_prc;
+    size_t work_amount;
+};
+
+struct jit_softmax_fused_call_args {
+    const void *src;
+    void *dst;
+    size_t oc_off;
+    const void* post_op_data;
+};
+
+struct jit_uni_softmax_fused_kernel {
+    void (*ker_)(const jit_softmax_fused_call_args *);
+
+    void operator()(const jit_softmax_fused_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_softmax_fused_kernel(jit_softmax_fused_config_params jcp, const dnnl_primitive_attr &attr) :
+        ker_(nullptr), jcp_(jcp), attr_(attr) {}
+    virtual ~jit_uni_softmax_fused_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_softmax_fused_config_params jcp_;
+    const dnnl_primitive_attr &attr_;
+};
+
 class SoftMax : public Node {
 public:
     SoftMax(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
 
+    void initSupportedPrimitiveDescriptors() override;
     void initOptimalPrimitiveDescriptor() override;
     void createDescriptor(const std::vector<MemoryDescPtr>& inputDesc,
                           const std::vector<MemoryDescPtr>& outputDesc) override;
     void getSupportedDescriptors() override;
     bool created() const override;
+    bool canFuse(const NodePtr& node) const override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
     void prepareParams() override;
+    void execute(dnnl::stream strm) override;
     void executeDynamicImpl(dnnl::stream strm) override;
     std::vector<VectorDims> shapeInfer() const override;
 
 private:
+    void prepareFusedParams();
+    void setPostOps(dnnl::primitive_attr &attr, const VectorDims &dims);
+
     size_t axis = 0;
+
+    // JIT implementation used when the consumers are fused, the oneDNN primitive is used otherwise
+    std::shared_ptr<jit_uni_softmax_fused_kernel> fusedKernel;
+    std::vector<const void*> postOpsDataPtrs;
 };
 
 }   // namespace node
@@ -21,6 +21,7 @@
 #include <ie_ngraph_utils.hpp>
 
 #include <snippets/op/subgraph.hpp>
+#include <common/primitive_hashing_utils.hpp>
 #include "emitters/cpu_generator.hpp"
 #include "snippets_transformations/fuse_load_store_and_convert.hpp"
 #include "ngraph_transformations/convert_to_swish_cpu.hpp"
@@ -34,7 +35,54 @@ using namespace Xbyak;
 namespace ov {
 namespace intel_cpu {
 namespace node {
+namespace {
+
+struct SnippetKey {
+    // the original subgraph identifies the body, the copies are generated from it
+    const ngraph::snippets::op::Subgraph* snippet;
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputShapes;
+    ngraph::snippets::op::Subgraph::BlockedShapeVector outputShapes;
+
+    size_t hash() const {
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = 0;
+        seed = hash_combine(seed, snippet);
+        for (const auto* shapes : {&inputShapes, &outputShapes}) {
+            for (const auto& blockedShape : *shapes) {
+                seed = get_vector_hash(seed, std::get<0>(blockedShape));
+                seed = get_vector_hash(seed, std::get<1>(blockedShape));
+                seed = hash_combine(seed, std::get<2>(blockedShape).hash());
+            }
+        }
+        return seed;
+    }
+
+    bool operator==(const SnippetKey& rhs) const {
+        return snippet == rhs.snippet &&
+               inputShapes == rhs.inputShapes &&
+               outputShapes == rhs.outputShapes;
+    }
+};
+
+// Generated code together with the scheduling parameters it was generated for
+struct SnippetKernel {
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;  // owns the generated code
+    ngraph::snippets::Schedule schedule;
+    std::vector<size_t> exec_domain;
+    size_t tensorRank;
+    size_t schedulerWorkAmount;
+    bool canUseOptimizedImpl;
+};
+
+ngraph::snippets::op::Subgraph::BlockedShape edgeToBlockedShape(const EdgePtr& edge) {
+    const auto blockedDesc = edge->getMemory().GetDescWithType<BlockedMemoryDesc>();
+    ngraph::Shape shape(blockedDesc->getBlockDims());
+    ngraph::AxisVector blocking(blockedDesc->getOrder());
+    ngraph::element::Type precision = InferenceEngine::details::convertPrecision(blockedDesc->getPrecision());
+    return ngraph::snippets::op::Subgraph::BlockedShape{shape, blocking, precision};
+}
 
+}  // namespace
 
 Snippet::Snippet(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache)
         : Node(op, eng, cache) {
@@ -194,9 +242,14 @@ void Snippet::selectOptimalPrimitiveDescriptor() {
 }
 
 void Snippet::createPrimitive() {
+    if (isDynamicNode()) {
+        Node::createPrimitive();
+        return;
+    }
     // schedule definition part
     // it defines offsets, strides and sizes for snippet kernel scheduling
     define_schedule();
+    init_data_ptrs();
 
     // code generation part
     // it might be worth to generate explicitly for scheduler work amount for now,
@@ -206,6 +259,39 @@ void Snippet::createPrimitive() {
     generate();
 }
 
+void Snippet::prepareParams() {
+    SnippetKey key = {original_snippet.get(), {}, {}};
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        key.inputShapes.push_back(edgeToBlockedShape(getParentEdgesAtPort(i)[0]));
+    for (size_t i = 0; i < outputShapes.size(); i++)
+        key.outputShapes.push_back(edgeToBlockedShape(getChildEdgesAtPort(i)[0]));
+
+    auto builder = [this](const SnippetKey&) -> std::shared_ptr<SnippetKernel> {
+        // canonicalization and code generation modify the body, so every kernel is generated from a fresh copy
+        copy_snippet();
+        define_schedule();
+        generate();
+        return std::make_shared<SnippetKernel>(SnippetKernel{snippet, schedule, exec_domain, tensorRank,
+                                                             schedulerWorkAmount, canUseOptimizedImpl});
+    };
+
+    auto cache = getRuntimeCache();
+    auto result = cache->getOrCreate(key, builder);
+    const auto& kernel = result.first;
+    snippet = kernel->snippet;
+    schedule = kernel->schedule;
+    exec_domain = kernel->exec_domain;
+    tensorRank = kernel->tensorRank;
+    schedulerWorkAmount = kernel->schedulerWorkAmount;
+    canUseOptimizedImpl = kernel->canUseOptimizedImpl;
+
+    init_data_ptrs();
+}
+
+void Snippet::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
 void Snippet::execute(dnnl::stream strm) {
     if (schedule.ptr == nullptr || !canUseOptimizedImpl) {
         IE_THROW() << "Snippet can't use Optimized implementation and can't fallback to reference";
@@ -291,13 +377,6 @@ static auto collapseLastDims(std::vector<size_t>& dims, size_t dimsToCollapse) -
 }
 
 void Snippet::define_schedule() {
-    auto edgeToBlockedShape = [](const EdgePtr& edge) {
-        const auto blockedDesc = edge->getMemory().GetDescWithType<BlockedMemoryDesc>();
-        ngraph::Shape shape(blockedDesc->getBlockDims());
-        ngraph::AxisVector blocking(blockedDesc->getOrder());
-        ngraph::element::Type precision = InferenceEngine::details::convertPrecision(blockedDesc->getPrecision());
-        return ngraph::snippets::op::Subgraph::BlockedShape{shape, blocking, precision};
-    };
     auto prependWithOnes = [this](const std::vector<size_t>& dims) {
         if (tensorRank <= dims.size())
             return dims;
@@ -305,6 +384,16 @@ void Snippet::define_schedule() {
         std::copy(dims.begin(), dims.end(), &result[tensorRank - dims.size()]);
         return result;
     };
+    // the schedule may be redefined for new shapes
+    dims_in.clear();
+    dims_out.clear();
+    offsets_in.clear();
+    offsets_out.clear();
+    sch_dims.clear();
+    sch_offsets_in.clear();
+    sch_offsets_out.clear();
+    tileRank = 1;
+
     ngraph::snippets::op::Subgraph::BlockedShapeVector input_blocked_shapes;
     for (size_t i = 0; i < inputShapes.size(); i++)
         input_blocked_shapes.push_back(edgeToBlockedShape(getParentEdgesAtPort(i)[0]));
@@ -342,15 +431,6 @@ void Snippet::define_schedule() {
             }
         }
 
-        start_offset_in.resize(inputNum);
-        srcMemPtrs.resize(inputNum);
-        for (size_t i = 0; i < inputNum; i++) {
-            const auto memPtr = getParentEdgeAt(i)->getMemoryPtr();
-            srcMemPtrs[i] = memPtr;
-            start_offset_in[i] =  memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() *
-                    config.inConfs[i].getMemDesc()->getPrecision().size();
-        }
-
         const size_t outputNum = config.outConfs.size();
         offsets_out.resize(outputNum);
         for (size_t i = 0; i < outputNum; i++) {
@@ -360,15 +440,6 @@ void Snippet::define_schedule() {
                 offsets_out[i][j] *= config.outConfs[i].getMemDesc()->getPrecision().size();
             }
         }
-
-        start_offset_out.resize(outputNum);
-        dstMemPtrs.resize(outputNum);
-        for (size_t i = 0; i < outputNum; i++) {
-            const auto memPtr = getChildEdgeAt(i)->getMemoryPtr();
-            dstMemPtrs[i] = memPtr;
-            start_offset_out[i] = memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() *
-                    config.outConfs[i].getMemDesc()->getPrecision().size();
-        }
     };
 
     auto find_dims_to_collapse = [this, config]() -> int {
@@ -478,6 +549,29 @@ void Snippet::define_schedule() {
     initSchedulingInfo();
 }
 
+void Snippet::init_data_ptrs() {
+    const auto config = getSelectedPrimitiveDescriptor()->getConfig();
+    const size_t inputNum = getParentEdges().size();
+    start_offset_in.resize(inputNum);
+    srcMemPtrs.resize(inputNum);
+    for (size_t i = 0; i < inputNum; i++) {
+        const auto memPtr = getParentEdgeAt(i)->getMemoryPtr();
+        srcMemPtrs[i] = memPtr;
+        start_offset_in[i] =  memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() *
+                config.inConfs[i].getMemDesc()->getPrecision().size();
+    }
+
+    const size_t outputNum = config.outConfs.size();
+    start_offset_out.resize(outputNum);
+    dstMemPtrs.resize(outputNum);
+    for (size_t i = 0; i < outputNum; i++) {
+        const auto memPtr = getChildEdgeAt(i)->getMemoryPtr();
+        dstMemPtrs[i] = memPtr;
+        start_offset_out[i] = memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() *
+                config.outConfs[i].getMemDesc()->getPrecision().size();
+    }
+}
+
 void Snippet::generate() {
     jit_snippets_compile_args jcp;
     jcp.output_dims = exec_domain;
@@ -45,6 +45,10 @@ public:
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(dnnl::stream strm) override;
 
+    // the kernel is generated for the particular input shapes, so it is regenerated (or taken from the cache) on shape change
+    void prepareParams() override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+
 private:
     static const size_t rank6D {6};
 
@@ -57,6 +61,8 @@ private:
 
     void define_schedule();
 
+    void init_data_ptrs();
+
     void generate();
 
     // Evaluates generated snippet using parallel backend
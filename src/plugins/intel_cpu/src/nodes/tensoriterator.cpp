@@ -229,88 +229,97 @@ DynamicBuffer::DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr
 }
 
 void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
-    if (iter == 0) {
+    if (iter == 0)
         init(eng);
-        return;
-    }
 
-    auto new_buffer = create_buffer(eng);
-    move_buffer(new_buffer);
+    if (from->getStaticDims()[map_rule.axis] != static_cast<size_t>(std::abs(map_rule.stride)))
+        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << std::abs(map_rule.stride) <<
+        " is expected, but actual: " << from->getStaticDims()[map_rule.axis];
+
+    if (num_execs == max_iter_count)
+        grow_buffer(eng);
+
     move_data();
+    num_execs++;
 }
 
 void DynamicBuffer::init(const dnnl::engine& eng) {
-    chunk_offset_in_byte = 0;
-    buffer_offset_in_byte = 0;
+    num_execs = 0;
 
     const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
+    const auto abs_stride = std::abs(map_rule.stride);
 
-    auto src_mem = from->GetPrimitive();
-    auto src_desc = src_mem.get_desc();
+    auto src_desc = from->GetPrimitive().get_desc();
     auto dims = src_desc.dims();
 
-    if (dims[axis] != abs_stride)
-        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-                   " is expected, but actual: " << dims[axis];
+    count = std::accumulate(dims.begin(), dims.begin() + axis, size_t(1), std::multiplies<size_t>());
+    len = std::accumulate(dims.begin() + axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
+    chunk_unit_in_byte = abs_stride * len;
 
-    count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, size_t(1), std::multiplies<size_t>());
-    len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
-    mem_holder_buffer.reset(new memory(src_desc, eng));
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()), 0, 0, 1, from->GetSize());
+    // the buffer of the previous inference is reused if the iteration chunk has the same geometry,
+    // so a steady state inference doesn't allocate at all
+    if (mem_holder_buffer) {
+        auto buffer_dims = mem_holder_buffer->get_desc().dims();
+        buffer_dims[axis] = dims[axis];
+        if (buffer_dims == dims && mem_holder_buffer->get_desc().data_type() == src_desc.data_type())
+            return;
+    }
+
+    max_iter_count = 1;
+    dims[axis] = abs_stride;
+    mem_holder_buffer = std::make_shared<dnnl::memory>(
+        dnnl::memory::desc(dims, src_desc.data_type(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size())), eng);
 }
 
-std::shared_ptr<dnnl::memory> DynamicBuffer::create_buffer(const dnnl::engine& eng) {
+void DynamicBuffer::grow_buffer(const dnnl::engine& eng) {
     const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
+    const auto abs_stride = std::abs(map_rule.stride);
+
+    // the capacity is doubled, so the concatenation of N iterations copies O(N) chunks in total instead of O(N^2)
+    const size_t new_max_iter_count = max_iter_count * 2;
 
     const auto old_desc = mem_holder_buffer->get_desc();
     auto dims = old_desc.dims();
+    dims[axis] = new_max_iter_count * abs_stride;
+    auto new_buffer = std::make_shared<dnnl::memory>(
+        dnnl::memory::desc(dims, old_desc.data_type(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size())), eng);
 
-    if (from->getStaticDims()[axis] != abs_stride)
-        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-        " is expected, but actual: " << from->getStaticDims()[axis];
-
-    dims[axis] += abs_stride;
-    dnnl::memory::desc new_buffer_desc(dims, old_desc.data_type(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size()));
+    copy(get_ptr(*mem_holder_buffer) + valid_offset_in_byte(max_iter_count),
+         get_ptr(*new_buffer) + valid_offset_in_byte(new_max_iter_count),
+         max_iter_count * chunk_unit_in_byte, new_max_iter_count * chunk_unit_in_byte, count, num_execs * chunk_unit_in_byte);
 
-    if (stride > 0.0f) {
-        chunk_offset_in_byte += new_buffer_desc.data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    } else {
-        buffer_offset_in_byte = from->GetPrimitive().get_desc().data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    }
-
-    return std::make_shared<dnnl::memory>(new_buffer_desc, eng);
-}
-
-void DynamicBuffer::move_buffer(std::shared_ptr<dnnl::memory> new_buffer) {
-    const auto axis = map_rule.axis;
-    const auto src_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
-    const auto dst_stride = new_buffer->get_desc().dims()[axis] * len;
-
-    copy(get_ptr(*mem_holder_buffer.get()), get_ptr(*new_buffer.get()) + buffer_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
     mem_holder_buffer = new_buffer;
+    max_iter_count = new_max_iter_count;
 }
 
 void DynamicBuffer::move_data() {
-    const auto axis = map_rule.axis;
-    const auto src_stride = abs(map_rule.stride) * len;
-    const auto dst_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
+    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer) + chunk_offset_in_byte(num_execs, max_iter_count),
+         chunk_unit_in_byte, max_iter_count * chunk_unit_in_byte, count, chunk_unit_in_byte);
+}
 
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + chunk_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+size_t DynamicBuffer::chunk_offset_in_byte(const size_t iter, const size_t iter_count) const {
+    // the positive stride appends the chunks, the negative one prepends them,
+    // so the latter fills the buffer from its end and the valid chunks are always adjacent
+    return (map_rule.stride > 0 ? iter : iter_count - 1 - iter) * chunk_unit_in_byte;
+}
+
+size_t DynamicBuffer::valid_offset_in_byte(const size_t iter_count) const {
+    return map_rule.stride > 0 ? 0 : (iter_count - num_execs) * chunk_unit_in_byte;
 }
 
 void DynamicBuffer::transfer(const Node* node) {
-    if (mem_holder_buffer) {
+    if (mem_holder_buffer && num_execs > 0) {
+        auto dims = mem_holder_buffer->get_desc().dims();
+        dims[map_rule.axis] = num_execs * std::abs(map_rule.stride);
         const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(
-                DnnlExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims()));
+                DnnlExtensionUtils::convertToVectorDims(dims));
         redefineToMemories(to, desc);
 
-        copy(get_ptr(*mem_holder_buffer.get()), reinterpret_cast<uint8_t*>(to.front()->GetPtr()), 0, 0, 1, to.front()->GetSize());
+        // only the valid chunks are copied, the rest of the capacity is not initialized
+        const size_t valid_len = num_execs * chunk_unit_in_byte;
+        copy(get_ptr(*mem_holder_buffer) + valid_offset_in_byte(max_iter_count),
+             reinterpret_cast<uint8_t*>(to.front()->GetPtr()),
+             max_iter_count * chunk_unit_in_byte, valid_len, count, valid_len);
     } else {
         VectorDims newDims = to.front()->GetShape().getDims();
         nullifyUndefinedDims(newDims);
@@ -319,7 +328,7 @@ void DynamicBuffer::transfer(const Node* node) {
         redefineToMemories(to, desc);
     }
 
-    mem_holder_buffer.reset();
+    num_execs = 0;
 }
 
 void DynamicBuffer::copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len) {
@@ -363,7 +372,7 @@ void TensorIterator::getSupportedDescriptors() {
         THROW_ERROR << "cannot be cast to ov::op::util::SubGraphOp";
     }
     const std::shared_ptr<const ov::Model> body = tiOp->get_function();
-    sub_graph.CreateGraph(body, ext_mng, weightCache, sharedMutex);
+    sub_graph.CreateGraph(body, ext_mng, weightCache, sharedMutex, getRuntimeCache());
 
     const auto &inMap = sub_graph.GetInputNodesMap();
     for (const auto &param : tiOp->get_function()->get_parameters()) {
@@ -60,7 +60,9 @@ protected:
 
 /**
  * Class for storing intermediate output buffer state for dynamism when we don't know
- * final output shape but we should concatenate output after each iteration
+ * final output shape but we should concatenate output after each iteration.
+ * The buffer capacity along the concatenation axis grows geometrically, so the chunk of every iteration
+ * is written in place and the stored data is moved only when the capacity is exceeded.
  */
 class DynamicBuffer {
 public:
@@ -74,9 +76,10 @@ private:
     void init(const dnnl::engine& eng);
 
     /* methods for resize and refill buffer */
-    std::shared_ptr<dnnl::memory> create_buffer(const dnnl::engine& eng);
-    void move_buffer(std::shared_ptr<dnnl::memory> new_buffer);
+    void grow_buffer(const dnnl::engine& eng);
     void move_data();
+    size_t chunk_offset_in_byte(const size_t iter, const size_t iter_count) const;
+    size_t valid_offset_in_byte(const size_t iter_count) const;
 
     static void copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len);
     static uint8_t* get_ptr(dnnl::memory& prim);
@@ -84,8 +87,9 @@ private:
     size_t len = 1lu;
     size_t count = 1lu;
     size_t elem_size = 0lu;
-    ptrdiff_t chunk_offset_in_byte = 0;
-    ptrdiff_t buffer_offset_in_byte = 0;
+    size_t chunk_unit_in_byte = 0lu;   // the size of the single iteration chunk in a row
+    size_t num_execs = 0lu;            // the number of the chunks stored in the buffer
+    size_t max_iter_count = 0lu;       // the buffer capacity in the chunks
 
     MemoryPtr from;
     std::vector<MemoryPtr> to;
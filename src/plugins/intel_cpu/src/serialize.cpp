@@ -4,6 +4,7 @@
 #include "serialize.h"
 
 #include <openvino/pass/serialize.hpp>
+#include <ie_shared_stream_buffer.hpp>
 
 #include <pugixml.hpp>
 
@@ -12,6 +13,31 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 namespace {
+    // Allocator of the blob which shares a part of the memory mapped cache entry
+    class SharedBufferAllocator : public InferenceEngine::IAllocator {
+    public:
+        SharedBufferAllocator(std::shared_ptr<ngraph::runtime::AlignedBuffer> buffer, size_t offset)
+            : _buffer(std::move(buffer)), _offset(offset) {}
+
+        void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+            return handle;
+        }
+
+        void unlock(void*) noexcept override {}  // NOLINT
+
+        void* alloc(size_t) noexcept override {
+            return _buffer->get_ptr<char>() + _offset;
+        }
+
+        bool free(void*) noexcept override {  // NOLINT
+            return true;
+        }
+
+    private:
+        std::shared_ptr<ngraph::runtime::AlignedBuffer> _buffer;
+        size_t _offset;
+    };
+
     std::string to_string(InferenceEngine::Layout layout) {
         std::stringstream ss;
         ss << layout;
@@ -152,10 +178,21 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
+        const InferenceEngine::TensorDesc constsDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C);
+        // the memory mapped cache entry is shared instead of being copied
+        auto sharedStreamBuffer = dynamic_cast<InferenceEngine::SharedStreamBuffer*>(_istream.rdbuf());
+        if (sharedStreamBuffer) {
+            const auto& buffer = sharedStreamBuffer->getBuffer();
+            if (hdr.consts_offset + hdr.consts_size > buffer->size())
+                IE_THROW(NetworkNotRead) << "The constants data is out of the stream bounds.";
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+                constsDesc, std::make_shared<SharedBufferAllocator>(buffer, hdr.consts_offset));
+        } else {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(constsDesc);
+        }
         dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        if (!sharedStreamBuffer)
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
     }
 
     // read XML content
@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_utils.h"
+
+#include <cstdint>
+#include <vector>
+
+#if defined(__linux__)
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_move_pages)
+
+namespace {
+// the values from linux/mempolicy.h, the kernel interface is used directly to avoid the dependency on libnuma
+constexpr int mpolPreferred = 1;
+constexpr unsigned mpolMfMove = 1 << 1;
+
+// returns the range of the pages entirely covered by the region
+bool getPagesRange(const void* ptr, size_t size, uintptr_t& begin, uintptr_t& end) {
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    if (pageSize <= 0)
+        return false;
+    const auto page = static_cast<uintptr_t>(pageSize);
+    const auto addr = reinterpret_cast<uintptr_t>(ptr);
+    begin = (addr + page - 1) / page * page;
+    end = (addr + size) / page * page;
+    return begin < end;
+}
+}  // namespace
+
+bool bindToNumaNode(void* ptr, size_t size, int numaNodeId) {
+    uintptr_t begin = 0, end = 0;
+    if (numaNodeId < 0 || ptr == nullptr || !getPagesRange(ptr, size, begin, end))
+        return false;
+
+    constexpr size_t maskBits = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> nodeMask(numaNodeId / maskBits + 1, 0);
+    nodeMask[numaNodeId / maskBits] |= 1ul << (numaNodeId % maskBits);
+
+    const long res = syscall(SYS_mbind, reinterpret_cast<void*>(begin), end - begin, mpolPreferred, nodeMask.data(),
+                             nodeMask.size() * maskBits + 1, mpolMfMove);
+    return res == 0;
+}
+
+size_t getSizeAtNumaNode(const void* ptr, size_t size, int numaNodeId) {
+    uintptr_t begin = 0, end = 0;
+    if (numaNodeId < 0 || ptr == nullptr || !getPagesRange(ptr, size, begin, end))
+        return 0;
+
+    const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    constexpr size_t batchSize = 1024;
+    std::vector<void*> pages;
+    std::vector<int> status;
+    pages.reserve(batchSize);
+    status.reserve(batchSize);
+
+    size_t result = 0;
+    for (uintptr_t addr = begin; addr < end;) {
+        pages.clear();
+        for (; addr < end && pages.size() < batchSize; addr += pageSize) {
+            pages.push_back(reinterpret_cast<void*>(addr));
+        }
+        status.assign(pages.size(), -1);
+        // without the target nodes the call only reports the current node of each page
+        if (syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0)
+            return 0;
+        for (auto node : status) {
+            if (node == numaNodeId)
+                result += pageSize;
+        }
+    }
+    return result;
+}
+
+#else
+
+bool bindToNumaNode(void* ptr, size_t size, int numaNodeId) {
+    return false;
+}
+
+size_t getSizeAtNumaNode(const void* ptr, size_t size, int numaNodeId) {
+    return 0;
+}
+
+#endif
+
+}   // namespace intel_cpu
+}   // namespace ov
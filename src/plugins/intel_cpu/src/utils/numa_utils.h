@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Makes the NUMA node preferred for the pages of the memory region and migrates the already touched pages there.
+ * Only the pages entirely covered by the region are affected, so the neighbouring allocations keep their placement.
+ * The policy is not strict: if the node is out of memory the pages are allocated on the other nodes.
+ * @param ptr beginning of the memory region
+ * @param size size of the region in bytes
+ * @param numaNodeId OS index of the NUMA node
+ * @return true if the policy is applied, false if it is not supported by the system
+ */
+bool bindToNumaNode(void* ptr, size_t size, int numaNodeId);
+
+/**
+ * @brief Counts the size of the memory region located at the NUMA node.
+ * The pages partially covered by the region are not taken into account, the pages not touched yet are not counted.
+ * @param ptr beginning of the memory region
+ * @param size size of the region in bytes
+ * @param numaNodeId OS index of the NUMA node
+ * @return number of bytes located at the node, 0 if the placement can not be queried on the system
+ */
+size_t getSizeAtNumaNode(const void* ptr, size_t size, int numaNodeId);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -5,13 +5,34 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include "openvino/util/data_hash.hpp"
+#include "utils/numa_utils.h"
+#include "nodes/common/cpu_memcpy.h"
+#include <common/primitive_hashing_utils.hpp>
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
 
 const SimpleDataHash WeightsSharing::simpleCRC;
 
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    const size_t chunksCount = ov::util::data_hash_chunks_count(size);
+    if (chunksCount == 1)
+        return ov::util::hash_data_chunk(data, size, 0);
+
+    std::vector<uint64_t> chunkHashes(chunksCount);
+    InferenceEngine::parallel_for(chunksCount, [&](size_t i) {
+        const size_t offset = i * ov::util::data_hash_chunk_size;
+        chunkHashes[i] = ov::util::hash_data_chunk(data + offset, std::min(ov::util::data_hash_chunk_size, size - offset), i);
+    });
+    return ov::util::combine_chunk_hashes(chunkHashes.data(), chunksCount, size);
+}
+
 WeightsSharing::SharedMemory::SharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MemoryInfo::Ptr & memory,
@@ -46,6 +67,10 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
             newPtr = create();
+            // the replica must be local to the streams of the node, regardless of the thread that filled it
+            if (numaNodeId >= 0 && newPtr && newPtr->isAllocated() && newPtr->getDesc().isDefined()) {
+                bindToNumaNode(newPtr->GetData(), newPtr->GetSize(), numaNodeId);
+            }
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -71,9 +96,42 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+WeightsSharing::Placement WeightsSharing::getPlacement() const {
+    std::vector<MemoryPtr> memories;
+    {
+        std::unique_lock<std::mutex> lock(guard);
+        memories.reserve(sharedWeights.size());
+        for (const auto& item : sharedWeights) {
+            if (auto memory = item.second->sharedMemory.lock())
+                memories.push_back(memory);
+        }
+    }
+
+    Placement result;
+    for (const auto& memory : memories) {
+        if (!memory->isAllocated() || !memory->getDesc().isDefined())
+            continue;
+        result.totalSize += memory->GetSize();
+        if (numaNodeId >= 0)
+            result.localSize += getSizeAtNumaNode(memory->GetData(), memory->GetSize(), numaNodeId);
+    }
+    return result;
+}
+
 NumaNodesWeights::NumaNodesWeights() {
-    for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<WeightsSharing>();
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    // the explicit placement makes sense only if the replicas may be allocated on the remote node
+    const bool bindToNode = numaNodes.size() > 1;
+    for (auto numa_id : numaNodes)
+        _cache_map[numa_id] = std::make_shared<WeightsSharing>(bindToNode ? numa_id : -1);
+}
+
+std::map<int, WeightsSharing::Placement> NumaNodesWeights::getPlacement() const {
+    std::map<int, WeightsSharing::Placement> result;
+    for (const auto& item : _cache_map) {
+        result[item.first] = item.second->getPlacement();
+    }
+    return result;
 }
 
 WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
@@ -90,5 +148,104 @@ const WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const {
     return found->second;
 }
 
+ConstantsCache& ConstantsCache::getInstance() {
+    static ConstantsCache cache;
+    return cache;
+}
+
+std::shared_ptr<void> ConstantsCache::use() {
+    std::lock_guard<std::mutex> lock(guard);
+    usersCount++;
+    return std::shared_ptr<void>(this, [](void* cache) {
+        static_cast<ConstantsCache*>(cache)->release();
+    });
+}
+
+void ConstantsCache::release() {
+    std::lock_guard<std::mutex> lock(guard);
+    if (--usersCount == 0) {
+        slots.clear();
+        lru.clear();
+        totalSize = 0;
+    }
+}
+
+bool ConstantsCache::Entry::matches(const Key& key, int port) const {
+    if (this->port != port || signature != key.signature || constants.size() != key.constants.size())
+        return false;
+    for (size_t i = 0; i < constants.size(); i++) {
+        const auto& memory = key.constants[i];
+        if (constants[i].size() != memory->GetSize() ||
+            std::memcmp(constants[i].data(), memory->GetData(), constants[i].size()) != 0)
+            return false;
+    }
+    return true;
+}
+
+uint64_t ConstantsCache::lookupHash(const Key& key, int port) {
+    uint64_t seed = dnnl::impl::hash_combine(key.hash, key.signature);
+    return dnnl::impl::hash_combine(seed, port);
+}
+
+MemoryCPtr ConstantsCache::get(const Key& key, int port) {
+    const auto hash = lookupHash(key, port);
+    std::shared_ptr<const Entry> entry;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = slots.find(hash);
+        if (found == slots.end())
+            return nullptr;
+        entry = found->second.entry;
+        lru.splice(lru.begin(), lru, found->second.lruPosition);
+    }
+
+    // the stored entries are immutable, so the constants (which may be large) are compared outside of the lock
+    return entry->matches(key, port) ? entry->memory : nullptr;
+}
+
+void ConstantsCache::put(const Key& key, int port, const Memory& memory, size_t capacity) {
+    size_t size = memory.GetSize();
+    for (const auto& constant : key.constants)
+        size += constant->GetSize();
+    if (size > capacity)
+        return;
+
+    // the copies are made outside of the lock, the weights may be large
+    auto entry = std::make_shared<Entry>();
+    entry->signature = key.signature;
+    entry->port = port;
+    entry->size = size;
+    for (const auto& constant : key.constants) {
+        const auto data = static_cast<const uint8_t*>(constant->GetData());
+        entry->constants.emplace_back(data, data + constant->GetSize());
+    }
+    auto copy = std::make_shared<Memory>(memory.getEngine());
+    copy->Create(memory.getDesc());
+    cpu_memcpy(copy->GetData(), memory.GetData(), memory.GetSize());
+    entry->memory = copy;
+
+    const auto hash = lookupHash(key, port);
+    std::lock_guard<std::mutex> lock(guard);
+    // on a hash collision the entry stored first is kept, nothing is kept when there are no users
+    if (usersCount == 0 || slots.count(hash))
+        return;
+
+    while (!lru.empty() && totalSize + size > capacity) {
+        auto evicted = slots.find(lru.back());
+        totalSize -= evicted->second.entry->size;
+        slots.erase(evicted);
+        lru.pop_back();
+    }
+
+    lru.push_front(hash);
+    slots[hash] = {entry, lru.begin()};
+    totalSize += size;
+}
+
+size_t ConstantsCache::getSize() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return totalSize;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
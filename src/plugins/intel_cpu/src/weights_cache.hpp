@@ -13,6 +13,8 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <list>
+#include <vector>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -25,26 +27,9 @@ namespace intel_cpu {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
-
-protected:
-    static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
+    // Computes 64-bit hash of the data. Large buffers are split into the fixed size chunks hashed in parallel,
+    // so the result doesn't depend on the number of threads.
+    uint64_t hash(const unsigned char* data, size_t size) const;
 };
 
 /**
@@ -70,6 +55,11 @@ class WeightsSharing {
 public:
     typedef std::shared_ptr<WeightsSharing> Ptr;
 
+    /**
+     * @param numaNodeId NUMA node the weights are placed at, -1 means no explicit placement
+     */
+    explicit WeightsSharing(int numaNodeId = -1) : numaNodeId(numaNodeId) {}
+
     class SharedMemory {
     public:
         typedef std::shared_ptr<SharedMemory> Ptr;
@@ -96,10 +86,25 @@ public:
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
+    struct Placement {
+        size_t totalSize = 0;   // size of all the alive cached objects
+        size_t localSize = 0;   // size of the pages located at the NUMA node of the cache
+    };
+
+    /**
+     * @brief Queries the actual placement of the cached weights
+     */
+    Placement getPlacement() const;
+
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
     static const SimpleDataHash simpleCRC;
+    const int numaNodeId;
 };
 
 /**
@@ -114,9 +119,88 @@ public:
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * @brief Queries the placement of the weights replicas of all the NUMA nodes
+     */
+    std::map<int, WeightsSharing::Placement> getPlacement() const;
+
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
 
+/**
+ * Process wide LRU store of the constant nodes outputs addressed by the content of the constant subgraphs
+ * which produced them (see Graph::ExecuteConstantNodesOnly), so another compilation of the same weights copies
+ * the stored result instead of executing the constant subgraph again.
+ * The stored objects are the copies owned by the cache, so they don't keep the graphs memory alive.
+ *
+ * Is a thread safe
+ */
+class ConstantsCache {
+public:
+    /**
+     * Identity of a constant subgraph: the description of the output operation, its edges and implementation
+     * together with the hashes of the parent subgraphs, and the data of all the constant inputs of the subgraph
+     * (each one once). The hash covers the whole subgraph and is used for the lookup, a hit is confirmed by
+     * the comparison of the signature and the constants data.
+     */
+    struct Key {
+        uint64_t hash = 0;
+        std::string signature;
+        std::vector<MemoryCPtr> constants;
+    };
+
+    static ConstantsCache& getInstance();
+
+    /**
+     * @brief Registers a user of the cache (a compiled model with the cache enabled). The stored entries are released
+     * when the last returned handle is destroyed, so the cache doesn't hold the memory after the models are unloaded.
+     */
+    std::shared_ptr<void> use();
+
+    /**
+     * @brief Returns the stored output of the port and marks it as the most recently used one, nullptr if
+     * the key is unknown
+     */
+    MemoryCPtr get(const Key& key, int port);
+
+    /**
+     * @brief Stores a copy of the output together with a copy of the key constants evicting the least recently
+     * used entries, so the total size of the stored data doesn't exceed the capacity (in bytes).
+     * The entries larger than the capacity are not stored, nothing is stored when the cache has no users.
+     */
+    void put(const Key& key, int port, const Memory& memory, size_t capacity);
+
+    size_t getSize() const;
+
+private:
+    ConstantsCache() = default;
+
+    struct Entry {
+        std::string signature;
+        int port;
+        std::vector<std::vector<uint8_t>> constants;
+        MemoryCPtr memory;
+        size_t size;
+
+        bool matches(const Key& key, int port) const;
+    };
+
+    struct Slot {
+        std::shared_ptr<const Entry> entry;
+        std::list<uint64_t>::iterator lruPosition;
+    };
+
+    static uint64_t lookupHash(const Key& key, int port);
+
+    void release();
+
+    mutable std::mutex guard;
+    size_t usersCount = 0;
+    std::list<uint64_t> lru;   // the most recently used key goes first
+    std::unordered_map<uint64_t, Slot> slots;
+    size_t totalSize = 0;
+};
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -74,7 +74,12 @@ public:
         size_t defaultIndex;
         std::tie(inputShapes, indices, offsets, defaultIndex, withWeights, withDefIndex) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // the fp32 and bf16 tables are processed by the JIT kernel, the bf16 one is converted to fp32 without avx512_core
+        const bool isJit = inType == ElementType::f32 || inType == ElementType::bf16;
+        const bool bf16AsF32 = inType == ElementType::bf16 && !InferenceEngine::with_cpu_x86_avx512_core();
+        selectedType = makeSelectedTypeStr(isJit ? getPrimitiveType() : "ref", bf16AsF32 ? ElementType::f32 : inType);
+        if (inType == ElementType::bf16)
+            rel_threshold = 1e-2f;
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -106,6 +111,7 @@ namespace {
 
 const std::vector<ElementType> netPrecisions = {
         ElementType::f32,
+        ElementType::bf16,
         ElementType::i32,
         ElementType::u8
 };
@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <openvino/opsets/opset9.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace CPULayerTestsDefinitions {
+
+using GridSampleCPUTestParams = typename std::tuple<
+        std::vector<InputShape>,                            // Data and grid shapes
+        ov::op::v9::GridSample::InterpolationMode,          // Interpolation mode
+        ov::op::v9::GridSample::PaddingMode,                // Padding mode
+        bool>;                                              // Align corners
+
+class GridSampleLayerCPUTest : public testing::WithParamInterface<GridSampleCPUTestParams>,
+                               virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<GridSampleCPUTestParams> obj) {
+        std::vector<InputShape> inputShapes;
+        ov::op::v9::GridSample::InterpolationMode mode;
+        ov::op::v9::GridSample::PaddingMode paddingMode;
+        bool alignCorners;
+        std::tie(inputShapes, mode, paddingMode, alignCorners) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=(";
+        for (const auto& shape : inputShapes) {
+            result << CommonTestUtils::partialShape2str({shape.first}) << "_";
+        }
+        result << ")_TS=(";
+        for (const auto& shape : inputShapes) {
+            for (const auto& item : shape.second) {
+                result << CommonTestUtils::vec2str(item) << "_";
+            }
+        }
+        result << ")_Mode=" << mode << "_";
+        result << "PaddingMode=" << paddingMode << "_";
+        result << "AlignCorners=" << alignCorners;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<InputShape> inputShapes;
+        ov::op::v9::GridSample::Attributes attributes;
+        std::tie(inputShapes, attributes.mode, attributes.padding_mode, attributes.align_corners) = GetParam();
+        init_input_shapes(inputShapes);
+
+        selectedType = makeSelectedTypeStr("ref_any", ov::element::f32);
+
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        auto gridSample = std::make_shared<ov::op::v9::GridSample>(params[0], params[1], attributes);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(gridSample)};
+        function = std::make_shared<ngraph::Function>(results, params, "GridSample");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& funcInput = funcInputs[i];
+            ov::Tensor tensor;
+            if (i == 1) {
+                // the grid exceeds [-1, 1] a bit to cover the padding
+                tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes[i], 3, -1.5, 1000);
+            } else {
+                tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes[i], 10, -5, 100);
+            }
+            inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        }
+    }
+};
+
+TEST_P(GridSampleLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    CheckPluginRelatedResults(compiledModel, "GridSample");
+}
+
+namespace {
+
+const std::vector<std::vector<InputShape>> inputShapes = {
+    {{{}, {{1, 3, 10, 12}}}, {{}, {{1, 5, 7, 2}}}},
+    {{{}, {{2, 16, 1, 9}}}, {{}, {{2, 4, 4, 2}}}},
+    {{{-1, -1, -1, -1}, {{1, 2, 8, 8}, {3, 5, 4, 11}, {1, 2, 8, 8}}},
+     {{-1, -1, -1, 2}, {{1, 3, 3, 2}, {3, 17, 20, 2}, {1, 3, 3, 2}}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_GridSampleCPU, GridSampleLayerCPUTest,
+                        ::testing::Combine(
+                            ::testing::ValuesIn(inputShapes),
+                            ::testing::Values(ov::op::v9::GridSample::InterpolationMode::BILINEAR,
+                                              ov::op::v9::GridSample::InterpolationMode::BICUBIC,
+                                              ov::op::v9::GridSample::InterpolationMode::NEAREST),
+                            ::testing::Values(ov::op::v9::GridSample::PaddingMode::ZEROS,
+                                              ov::op::v9::GridSample::PaddingMode::BORDER,
+                                              ov::op::v9::GridSample::PaddingMode::REFLECTION),
+                            ::testing::Values(true, false)),
+                        GridSampleLayerCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
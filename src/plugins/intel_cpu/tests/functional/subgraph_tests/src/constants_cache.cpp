@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (compressed convolution weights):
+/*
+ *                Constant (f16)
+ *                      |
+ *    Parameter      Convert
+ *         \           |
+ *          \       Multiply (scales)
+ *           \       /
+ *          Convolution
+ *               |
+ *             Result
+ */
+// The second compilation of the same model takes the reordered weights from the constants cache
+// instead of executing the constant subgraph, the results must be the same. The zero capacity disables the cache.
+
+using ConstantsCacheParams = std::string;  // the cache capacity
+
+class ConstantsCacheTest : public testing::WithParamInterface<ConstantsCacheParams>,
+                           virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ConstantsCacheParams> obj) {
+        return "capacity=" + obj.param;
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_CONSTANTS_CACHE_CAPACITY, GetParam()});
+
+        InputShape inputShape{{}, {{1, 16, 10, 10}}};
+        init_input_shapes({inputShape});
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        auto weights = ngraph::builder::makeConstant<ov::float16>(ngraph::element::f16, {32, 16, 3, 3}, {}, true);
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngPrc);
+        auto scales = ngraph::builder::makeConstant<float>(ngPrc, {32, 1, 1, 1}, {}, true);
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scales);
+
+        auto conv = std::make_shared<ngraph::opset1::Convolution>(inputParams[0], multiply, ngraph::Strides{1, 1},
+                                                                  ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                                  ngraph::Strides{1, 1});
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ConstantsCache");
+    }
+};
+
+TEST_P(ConstantsCacheTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    // the same weights are compiled once again
+    compile_model();
+    const auto stat = compiledModel.get_property(ov::intel_cpu::constants_cache_statistics);
+    if (std::stoull(GetParam()) > 0) {
+        ASSERT_GT(stat.at("HITS"), 0u);
+        ASSERT_GT(stat.at("SIZE"), 0u);
+    } else {
+        ASSERT_EQ(stat.at("HITS"), 0u);
+    }
+
+    infer();
+    validate();
+}
+
+TEST_P(ConstantsCacheTest, ReleasedWithModels) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    compile_model();
+    // the cache is emptied when the last model using it is unloaded
+    compiledModel = {};
+    auto otherConfig = configuration;
+    otherConfig[PluginConfigInternalParams::KEY_CPU_CONSTANTS_CACHE_CAPACITY] = std::string("0");
+    auto other = core->compile_model(function, targetDevice, otherConfig);
+    ASSERT_EQ(other.get_property(ov::intel_cpu::constants_cache_statistics).at("SIZE"), 0u);
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ConstantsCache_CPU, ConstantsCacheTest,
+                         ::testing::Values("0", "268435456"),
+                         ConstantsCacheTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *      Parameter [-1, 16]
+ *             |
+ *      MatMul (weights [16, 8])
+ *             |
+ *           Result
+ */
+// The user tensors of the dynamic input and output have to be used by the graph directly, while the output fits
+// into the provided tensor.
+
+class DynamicIOZeroCopy : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, {ov::PartialShape{-1, IC}});
+        auto weights = ngraph::builder::makeConstant<float>(ngPrc, {IC, OC}, weightsData);
+        auto matMul = std::make_shared<ngraph::opset1::MatMul>(inputParams[0], weights);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(matMul)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "DynamicIOZeroCopy");
+    }
+
+    static constexpr size_t IC = 16;
+    static constexpr size_t OC = 8;
+    const std::vector<float> weightsData = std::vector<float>(IC * OC, 0.5f);
+};
+
+TEST_F(DynamicIOZeroCopy, smoke_DynamicIOZeroCopy_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    compile_model();
+    auto inferRequest = compiledModel.create_infer_request();
+
+    const size_t maxRows = 6;
+    std::vector<float> outputData(maxRows * OC, 0.f);
+    // the output tensor is allocated for the largest batch, the smaller outputs have to reuse it
+    ov::Tensor outputTensor(ov::element::f32, {maxRows, OC}, outputData.data());
+    inferRequest.set_output_tensor(outputTensor);
+
+    for (size_t rows : {6, 3, 1}) {
+        std::vector<float> inputData(rows * IC, 1.f);
+        inferRequest.set_input_tensor(ov::Tensor(ov::element::f32, {rows, IC}, inputData.data()));
+        inferRequest.infer();
+
+        const auto output = inferRequest.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), (ov::Shape{rows, OC}));
+        ASSERT_EQ(output.data(), outputData.data());
+        for (size_t i = 0; i < rows * OC; i++) {
+            ASSERT_FLOAT_EQ(outputData[i], IC * 0.5f);
+        }
+    }
+
+    const auto stat = compiledModel.get_property(ov::intel_cpu::io_copy_statistics);
+    ASSERT_GE(stat.at("ZERO_COPY"), 3u);
+    ASSERT_EQ(stat.at("CAPACITY"), 0u);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (attention-like scores with a varying sequence length):
+/*
+ *        Parameter      Parameter
+ *             \          /
+ *         MatMul (transpose_b)      ShapeOf
+ *                 |                    |
+ *              Softmax ---------- Broadcast(bias)
+ *                      \          /
+ *                          Add
+ *                           |
+ *                         Result
+ */
+// The sequence lengths repeat, so the shape inference of the repeated shapes has to be resolved by the cache,
+// including the data dependent Broadcast.
+
+class DynamicShapeInferCache : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const std::vector<size_t> seqLens = {16, 32, 16, 128, 32, 16, 64, 16, 32};
+        InputShape queryShape{{1, -1, 64}, {}};
+        InputShape keyShape{{1, -1, 64}, {}};
+        for (auto len : seqLens) {
+            queryShape.second.push_back({1, len, 64});
+            keyShape.second.push_back({1, len, 64});
+        }
+        init_input_shapes({queryShape, keyShape});
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        auto matMul = std::make_shared<ngraph::opset1::MatMul>(inputParams[0], inputParams[1], false, true);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(matMul, 2);
+        auto bias = ngraph::builder::makeConstant<float>(ngPrc, {1}, {0.5f});
+        auto shapeOf = std::make_shared<ngraph::opset3::ShapeOf>(softmax);
+        auto broadcast = std::make_shared<ngraph::opset3::Broadcast>(bias, shapeOf);
+        auto add = std::make_shared<ngraph::opset1::Add>(softmax, broadcast);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(add)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "DynamicShapeInferCache");
+    }
+};
+
+TEST_F(DynamicShapeInferCache, smoke_DynamicShapeInferCache_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    const auto stat = compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics);
+    ASSERT_GT(stat.at("SHAPE_INFER_MISSES"), 0u);
+    ASSERT_GT(stat.at("SHAPE_INFER_HITS"), 0u);
+}
+
+} // namespace SubgraphTestsDefinitions
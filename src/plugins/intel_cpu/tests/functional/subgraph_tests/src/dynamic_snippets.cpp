@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (eltwise tail of the BERT-like encoder with a dynamic batch and sequence length):
+/*
+ *        Parameter    Parameter [?, ?, 1]
+ *              \       /
+ *                 Add       Constant
+ *                   \       /
+ *                   Multiply
+ *                      |
+ *                   Sigmoid
+ *                      |
+ *                    Result
+ */
+// The whole chain has to be tokenized to the single Subgraph node, which is regenerated (or taken from the cache)
+// for every new combination of the input shapes.
+
+class DynamicSnippetsTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape dataShape{{-1, -1, 16}, {{1, 10, 16}, {2, 5, 16}, {1, 10, 16}, {3, 7, 16}, {2, 5, 16}}};
+        InputShape maskShape{{-1, -1, 1}, {{1, 10, 1}, {2, 5, 1}, {1, 10, 1}, {3, 7, 1}, {2, 5, 1}}};
+        init_input_shapes({dataShape, maskShape});
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        auto add = std::make_shared<ngraph::opset1::Add>(inputParams[0], inputParams[1]);
+        auto scale = ngraph::builder::makeConstant<float>(ngPrc, {16}, {}, true);
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(add, scale);
+        auto sigmoid = std::make_shared<ngraph::opset1::Sigmoid>(multiply);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(sigmoid)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "DynamicSnippets");
+    }
+};
+
+TEST_F(DynamicSnippetsTest, smoke_DynamicSnippets_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP();
+
+    run();
+
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+}
+
+} // namespace SubgraphTestsDefinitions
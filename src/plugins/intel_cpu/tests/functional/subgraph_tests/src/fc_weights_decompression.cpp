@@ -0,0 +1,201 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the compressed weights of the language models):
+/*
+ *           Constant (u8/i8/u4/i4 [N, K] or [N, G, K / G])
+ *                          |
+ *                   Convert (f32)
+ *                          |
+ *                  [Subtract (zero points)]
+ *                          |
+ *                  Multiply (scales)
+ *                          |
+ *      Parameter     [Reshape ([N, K])]
+ *               \     /
+ *               MatMul
+ *                 |
+ *               Result
+ */
+// The decompression subgraph has to be fused into FullyConnected, so the weights are kept in the compressed precision.
+// The weights are folded into a single FP32 constant as before when the decompression kernel isn't used for any input
+// shape (large number of the input rows or no avx2).
+
+using FCWeightsDecompressionParams = std::tuple<InputShape,           // data shape
+                                                ov::element::Type,    // weights precision
+                                                bool,                 // transpose_b
+                                                bool,                 // with zero points
+                                                size_t>;              // group size, 0 means per channel values
+
+class FCWeightsDecompressionTest : public testing::WithParamInterface<FCWeightsDecompressionParams>,
+                                   virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCWeightsDecompressionParams> obj) {
+        InputShape inputShape;
+        ov::element::Type weightsPrc;
+        bool transposeB, withZeroPoints;
+        size_t groupSize;
+        std::tie(inputShape, weightsPrc, transposeB, withZeroPoints, groupSize) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << CommonTestUtils::vec2str(shape) << "_";
+        }
+        result << "WeightsPrc=" << weightsPrc << "_";
+        result << "transposeB=" << transposeB << "_";
+        result << "withZeroPoints=" << withZeroPoints << "_";
+        result << "groupSize=" << groupSize;
+        return result.str();
+    }
+
+    // the decompression kernel is used for up to 8 input rows
+    bool isDecompressionFused() const {
+        size_t minRows = 1;
+        for (size_t i = 0; i + 1 < inputDynamicShapes[0].size(); i++)
+            minRows *= inputDynamicShapes[0][i].get_min_length();
+        return InferenceEngine::with_cpu_x86_avx2() && minRows <= 8;
+    }
+
+    // the size of the constants of the executable graph except the small ones (e.g. the Reshape target shape)
+    size_t getWeightsConstantsSize() const {
+        size_t size = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            const auto layerType = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            if (layerType == rtInfo.end() || layerType->second.as<std::string>() != "Const")
+                continue;
+            const auto elementsCount = ov::shape_size(node->get_output_shape(0));
+            if (elementsCount >= N)
+                size += elementsCount * node->get_output_element_type(0).size();
+        }
+        return size;
+    }
+
+protected:
+    static constexpr size_t N = 48;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        ov::element::Type weightsPrc;
+        bool transposeB, withZeroPoints;
+        size_t groupSize;
+        std::tie(inputShape, weightsPrc, transposeB, withZeroPoints, groupSize) = GetParam();
+        init_input_shapes({inputShape});
+
+        const auto ngPrc = ngraph::element::f32;
+        const size_t K = inputDynamicShapes[0].rbegin()->get_length();
+        ov::Shape weightsShape = transposeB ? ov::Shape{N, K} : ov::Shape{K, N};
+        ov::Shape channelsShape = transposeB ? ov::Shape{N, 1} : ov::Shape{1, N};
+        if (groupSize != 0) {
+            // the groups are defined for the transposed weights only
+            weightsShape = {N, K / groupSize, groupSize};
+            channelsShape = {N, K / groupSize, 1};
+        }
+
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+        std::shared_ptr<ngraph::Node> weights;
+        if (weightsPrc.bitwidth() == 4) {
+            const bool isSigned = weightsPrc.is_signed();
+            const auto values = NGraphFunctions::Utils::generateVector<ov::element::Type_t::i8>(
+                ov::shape_size(weightsShape), isSigned ? 7 : 15, isSigned ? -8 : 0);
+            weights = std::make_shared<ngraph::opset1::Constant>(weightsPrc, weightsShape, values);
+        } else {
+            weights = ngraph::builder::makeConstant<int8_t>(weightsPrc, weightsShape, {}, true, 15, 0);
+        }
+        std::shared_ptr<ngraph::Node> decompression = std::make_shared<ngraph::opset1::Convert>(weights, ngPrc);
+        if (withZeroPoints) {
+            auto zeroPoints = ngraph::builder::makeConstant<float>(ngPrc, channelsShape, {}, true, 8, 0);
+            decompression = std::make_shared<ngraph::opset1::Subtract>(decompression, zeroPoints);
+        }
+        auto scales = ngraph::builder::makeConstant<float>(ngPrc, channelsShape, {}, true, 1, 0);
+        decompression = std::make_shared<ngraph::opset1::Multiply>(decompression, scales);
+        if (groupSize != 0) {
+            auto targetShape = ngraph::opset1::Constant::create(ngraph::element::i64, {2},
+                                                                std::vector<int64_t>{static_cast<int64_t>(N),
+                                                                                     static_cast<int64_t>(K)});
+            decompression = std::make_shared<ngraph::opset1::Reshape>(decompression, targetShape, false);
+        }
+        auto matMul = std::make_shared<ngraph::opset1::MatMul>(inputParams[0], decompression, false, transposeB);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(matMul)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "FCWeightsDecompression");
+    }
+};
+
+TEST_P(FCWeightsDecompressionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    // the decompression subgraph is either fused or folded, so the only weights copy is kept
+    CheckNumberOfNodesWithType(compiledModel, "FullyConnected", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 0);
+
+    const size_t K = inputDynamicShapes[0].rbegin()->get_length();
+    const auto weightsPrc = std::get<1>(GetParam());
+    if (!isDecompressionFused()) {
+        ASSERT_EQ(getWeightsConstantsSize(), N * K * sizeof(float));
+    } else if (weightsPrc.bitwidth() == 4) {
+        ASSERT_EQ(getWeightsConstantsSize(), N * K / 2);
+    } else {
+        ASSERT_LE(getWeightsConstantsSize(), N * K);
+    }
+}
+
+namespace {
+const std::vector<InputShape> inputShapes = {
+    {{}, {{1, 64}}},
+    {{}, {{7, 64}}},
+    {{}, {{2, 5, 37}}},
+    {{}, {{16, 64}}},
+    {{-1, 64}, {{1, 64}, {9, 64}, {1, 64}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_CPU, FCWeightsDecompressionTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ov::element::u8, ov::element::i8),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(0)),
+                         FCWeightsDecompressionTest::getTestCaseName);
+
+const std::vector<InputShape> groupInputShapes = {
+    {{}, {{1, 128}}},
+    {{}, {{2, 3, 128}}},
+    {{}, {{3, 4, 128}}},
+    {{-1, 128}, {{1, 128}, {9, 128}, {1, 128}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_Groups_CPU, FCWeightsDecompressionTest,
+                         ::testing::Combine(::testing::ValuesIn(groupInputShapes),
+                                            ::testing::Values(ov::element::u8, ov::element::i8),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(32, 64)),
+                         FCWeightsDecompressionTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_INT4_CPU, FCWeightsDecompressionTest,
+                         ::testing::Combine(::testing::ValuesIn(groupInputShapes),
+                                            ::testing::Values(ov::element::u4, ov::element::i4),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(0, 32)),
+                         FCWeightsDecompressionTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraphs:
+/*
+ *      Parameter (plain layout)           Parameter (u8/i8)
+ *             |                                  |
+ *       Convert (f32)                 MaxPool (channels last layout)
+ *             |                                  |
+ *      Convolution (blocked layout)        Convert (f32)
+ *             |                                  |
+ *           Result                        Result (plain layout)
+ */
+// The precision conversion has to be performed by the Reorder from or to the plain layout, so no Convert node
+// is executed.
+
+using MergeConvertAndReorderParams = std::tuple<InputShape,           // input shape
+                                                ov::element::Type,    // input precision
+                                                bool>;                // the Convert follows a MaxPool
+
+class MergeConvertAndReorderTest : public testing::WithParamInterface<MergeConvertAndReorderParams>,
+                                   virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MergeConvertAndReorderParams> obj) {
+        InputShape inputShape;
+        ov::element::Type inputPrc;
+        bool convertAfterPool;
+        std::tie(inputShape, inputPrc, convertAfterPool) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << CommonTestUtils::vec2str(shape) << "_";
+        }
+        result << "InputPrc=" << inputPrc << "_";
+        result << (convertAfterPool ? "MaxPool_Convert" : "Convert_Convolution");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        ov::element::Type inputPrc;
+        bool convertAfterPool;
+        std::tie(inputShape, inputPrc, convertAfterPool) = GetParam();
+        init_input_shapes({inputShape});
+        // the Convolution has to be executed in f32 for the BF16 input as well
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::NO});
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(inputPrc, inputDynamicShapes);
+        std::shared_ptr<ngraph::Node> output;
+        if (convertAfterPool) {
+            auto pool = ngraph::builder::makePooling(inputParams[0], {1, 1}, {0, 0}, {0, 0}, {3, 3},
+                                                     ngraph::op::RoundingType::FLOOR, ngraph::op::PadType::EXPLICIT,
+                                                     false, ngraph::helpers::PoolingTypes::MAX);
+            output = std::make_shared<ngraph::opset1::Convert>(pool, ngPrc);
+        } else {
+            auto convert = std::make_shared<ngraph::opset1::Convert>(inputParams[0], ngPrc);
+            output = ngraph::builder::makeConvolution(convert, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, 16);
+        }
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(output)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "MergeConvertAndReorder");
+    }
+};
+
+TEST_P(MergeConvertAndReorderTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    if (std::get<1>(GetParam()) == ov::element::bf16 && !InferenceEngine::with_cpu_x86_avx512_core())
+        GTEST_SKIP();
+
+    run();
+
+    CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+}
+
+namespace {
+const std::vector<InputShape> inputShapes = {
+    {{}, {{1, 32, 10, 10}}},
+    {{}, {{2, 20, 7, 9}}},
+    {{-1, 20, -1, -1}, {{1, 20, 5, 5}, {2, 20, 11, 3}, {1, 20, 5, 5}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MergeConvertAndReorder_CPU, MergeConvertAndReorderTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ov::element::u8, ov::element::i8,
+                                                              ov::element::i32, ov::element::bf16),
+                                            ::testing::Values(false)),
+                         MergeConvertAndReorderTest::getTestCaseName);
+
+// the integer pooling works in the channels last layout only
+INSTANTIATE_TEST_SUITE_P(smoke_MergeReorderAndConvert_CPU, MergeConvertAndReorderTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ov::element::u8, ov::element::i8),
+                                            ::testing::Values(true)),
+                         MergeConvertAndReorderTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
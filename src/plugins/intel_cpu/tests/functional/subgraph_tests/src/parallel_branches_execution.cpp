@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (Inception-like block):
+/*
+ *                       Parameter
+ *              /       /         \        \
+ *         Conv1x1  Conv1x1     Conv1x1   MaxPool
+ *            |        |           |         |
+ *            |     Conv3x3     Conv5x5   Conv1x1
+ *            |        |           |         |
+ *            |      Relu        Relu        |
+ *             \        \         /         /
+ *                        Concat
+ *                          |
+ *                        Result
+ */
+
+class ParallelBranchesExecutionTest : public testing::WithParamInterface<std::string>,
+                                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "ParallelExecution=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION, GetParam()});
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeParams(ngPrc, {{1, 16, 14, 14}});
+
+        auto makeConv = [&](const ngraph::Output<ngraph::Node>& in, size_t kernel, size_t outChannels) {
+            const ptrdiff_t pad = kernel / 2;
+            return ngraph::builder::makeConvolution(in, ngPrc, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad}, {1, 1},
+                                                    ngraph::op::PadType::EXPLICIT, outChannels, true);
+        };
+
+        auto branch1 = makeConv(inputParams[0], 1, 8);
+
+        auto branch2 = makeConv(inputParams[0], 1, 8);
+        branch2 = std::make_shared<ngraph::opset1::Relu>(makeConv(branch2, 3, 16));
+
+        auto branch3 = makeConv(inputParams[0], 1, 4);
+        branch3 = std::make_shared<ngraph::opset1::Relu>(makeConv(branch3, 5, 8));
+
+        auto branch4 = ngraph::builder::makePooling(inputParams[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, ngraph::op::RoundingType::FLOOR,
+                                                    ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+        branch4 = makeConv(branch4, 1, 8);
+
+        auto concat = ngraph::builder::makeConcat({branch1, branch2, branch3, branch4}, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ParallelBranchesExecution");
+    }
+};
+
+namespace {
+TEST_P(ParallelBranchesExecutionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelBranchesExecution_CPU, ParallelBranchesExecutionTest,
+                         testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         ParallelBranchesExecutionTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                      RandomUniform [2, 3]
+ *                             |
+ *      Parameter [2, 3]      /
+ *               \           /
+ *                    Add
+ *                     |
+ *                   Result
+ */
+// RandomUniform has no native implementation, so it is executed by the Reference node on each inference and
+// has to be reported by the reference fallback statistics.
+
+class ReferenceFallbackStatistics : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeParams(ngPrc, {{2, 3}});
+        auto outShape = ov::opset8::Constant::create(ov::element::i64, {2}, {2, 3});
+        auto minValue = ov::opset8::Constant::create(ngPrc, {}, {0.f});
+        auto maxValue = ov::opset8::Constant::create(ngPrc, {}, {1.f});
+        auto randomUniform = std::make_shared<ov::opset8::RandomUniform>(outShape, minValue, maxValue, ngPrc, 1, 2);
+        randomUniform->set_friendly_name("random");
+        auto add = std::make_shared<ngraph::opset1::Add>(inputParams[0], randomUniform);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(add)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ReferenceFallbackStatistics");
+    }
+};
+
+TEST_F(ReferenceFallbackStatistics, smoke_ReferenceFallbackStatistics_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    compile_model();
+    auto inferRequest = compiledModel.create_infer_request();
+
+    const size_t inferCount = 3;
+    std::vector<float> inputData(2 * 3, 1.f);
+    inferRequest.set_input_tensor(ov::Tensor(ov::element::f32, {2, 3}, inputData.data()));
+    for (size_t i = 0; i < inferCount; i++) {
+        inferRequest.infer();
+    }
+
+    const auto stat = compiledModel.get_property(ov::intel_cpu::reference_fallback_statistics);
+    ASSERT_EQ(stat.at("RandomUniform:random:COUNT"), inferCount);
+    ASSERT_EQ(stat.count("RandomUniform:random:TIME_US"), 1u);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the attention scores normalization):
+/*
+ *           Parameter
+ *               |
+ *        Softmax (axis = -1)
+ *               |
+ *      Multiply -> Relu  or  FakeQuantize
+ *               |
+ *             Result
+ */
+// The consumers of the innermost axis Softmax have to be fused into it instead of being tokenized as a Subgraph.
+
+enum class SoftmaxFusedOps {
+    MultiplyRelu,
+    FakeQuantize
+};
+
+using SoftmaxFusingParams = std::tuple<InputShape, SoftmaxFusedOps>;
+
+class SoftmaxFusingTest : public testing::WithParamInterface<SoftmaxFusingParams>,
+                          virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SoftmaxFusingParams> obj) {
+        InputShape inputShape;
+        SoftmaxFusedOps fusedOps;
+        std::tie(inputShape, fusedOps) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << CommonTestUtils::vec2str(shape) << "_";
+        }
+        result << (fusedOps == SoftmaxFusedOps::FakeQuantize ? "FakeQuantize" : "MultiplyRelu");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        SoftmaxFusedOps fusedOps;
+        std::tie(inputShape, fusedOps) = GetParam();
+        init_input_shapes({inputShape});
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(inputParams[0], inputDynamicShapes[0].rank().get_length() - 1);
+
+        std::shared_ptr<ngraph::Node> output;
+        if (fusedOps == SoftmaxFusedOps::FakeQuantize) {
+            output = ngraph::builder::makeFakeQuantize(softmax, ngPrc, 256, {}, {0.f}, {1.f}, {0.f}, {1.f});
+            // a single quantization level is allowed to flip because of the exponent approximation
+            abs_threshold = 1e-2;
+        } else {
+            auto scale = ngraph::builder::makeConstant<float>(ngPrc, {}, {}, true);
+            output = std::make_shared<ngraph::opset1::Relu>(std::make_shared<ngraph::opset1::Multiply>(softmax, scale));
+        }
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(output)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "SoftmaxFusing");
+    }
+};
+
+TEST_P(SoftmaxFusingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    CheckNumberOfNodesWithType(compiledModel, "Softmax", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+    CheckNumberOfNodesWithType(compiledModel, "FakeQuantize", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 0);
+}
+
+namespace {
+const std::vector<InputShape> inputShapes = {
+    {{}, {{2, 4, 8, 64}}},
+    {{}, {{1, 3, 37}}},
+    {{-1, -1, -1, -1}, {{1, 2, 5, 19}, {2, 4, 8, 64}, {1, 2, 5, 19}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SoftmaxFusing_CPU, SoftmaxFusingTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(SoftmaxFusedOps::MultiplyRelu, SoftmaxFusedOps::FakeQuantize)),
+                         SoftmaxFusingTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
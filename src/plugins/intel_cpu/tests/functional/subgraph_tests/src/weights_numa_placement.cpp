@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// The weights of the multi-stream model are cached per NUMA node, the placement of the replicas is reported
+// by the compiled model.
+
+class WeightsNumaPlacement : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert(ov::num_streams(2));
+
+        init_input_shapes(static_shapes_to_test_representation({{1, 16, 14, 14}}));
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeParams(ngPrc, {{1, 16, 14, 14}});
+        auto conv = ngraph::builder::makeConvolution(inputParams[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 32, true);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "WeightsNumaPlacement");
+    }
+};
+
+TEST_F(WeightsNumaPlacement, smoke_WeightsNumaPlacement_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    const auto placement = compiledModel.get_property(ov::intel_cpu::weights_numa_placement);
+    ASSERT_FALSE(placement.empty());
+    uint64_t total = 0;
+    for (const auto& item : placement) {
+        const auto& key = item.first;
+        if (key.size() > 6 && key.compare(key.size() - 6, 6, "_TOTAL") == 0) {
+            total += item.second;
+            const auto local = placement.find(key.substr(0, key.size() - 6) + "_LOCAL");
+            ASSERT_NE(local, placement.end());
+            ASSERT_LE(local->second, item.second);
+        }
+    }
+    ASSERT_GT(total, 0u);
+}
+
+} // namespace SubgraphTestsDefinitions
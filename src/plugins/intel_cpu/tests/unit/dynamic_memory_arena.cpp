@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "dynamic_memory_arena.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+// Box {start, finish, size, id}
+//  0: |___|
+//  1:   |_____|
+//  2:         |___|
+const std::vector<MemorySolver::Box> testBoxes = {{0, 1, 0, 0}, {1, 3, 0, 1}, {3, 4, 0, 2}};
+
+uint8_t* rawPtr(const DynamicMemoryArena& arena, size_t idx) {
+    return static_cast<uint8_t*>(arena.getMemoryMngr(idx)->getRawPtr());
+}
+}  // namespace
+
+TEST(DynamicMemoryArenaTest, NoPlanBeforeFirstInference) {
+    DynamicMemoryArena arena(testBoxes, 4);
+    ASSERT_EQ(arena.getBoxesCount(), testBoxes.size());
+
+    arena.prepare({{1, 10}});
+    EXPECT_EQ(arena.getArenaSize(), 0u);
+    for (size_t i = 0; i < arena.getBoxesCount(); i++) {
+        EXPECT_FALSE(arena.getMemoryMngr(i)->hasExtBuffer());
+    }
+}
+
+TEST(DynamicMemoryArenaTest, PlacementReuse) {
+    DynamicMemoryArena arena(testBoxes, 4);
+    const DynamicMemoryArena::Signature signature = {{1, 10}};
+
+    arena.update(signature, {100, 200, 300});
+    arena.prepare(signature);
+
+    // the sizes are aligned to 64 bytes: 128, 256 and 320, the boxes 0 and 2 don't overlap in time and share the memory
+    EXPECT_EQ(arena.getArenaSize(), 576u);
+    for (size_t i = 0; i < arena.getBoxesCount(); i++) {
+        EXPECT_TRUE(arena.getMemoryMngr(i)->hasExtBuffer());
+    }
+    auto* ptr0 = rawPtr(arena, 0);
+    auto* ptr1 = rawPtr(arena, 1);
+    auto* ptr2 = rawPtr(arena, 2);
+    EXPECT_EQ(ptr0, ptr2);
+    EXPECT_TRUE(ptr1 >= ptr0 + 128 || ptr0 >= ptr1 + 256);
+    EXPECT_TRUE(ptr1 >= ptr2 + 320 || ptr2 >= ptr1 + 256);
+
+    // the sizes fit the slots, nothing changes
+    arena.update(signature, {64, 200, 1});
+    arena.prepare(signature);
+    EXPECT_EQ(arena.getArenaSize(), 576u);
+    EXPECT_EQ(rawPtr(arena, 1), ptr1);
+
+    // the resize within the slot doesn't reallocate
+    EXPECT_FALSE(arena.getMemoryMngr(1)->resize(256));
+    // the resize over the slot falls back to the own allocation
+    EXPECT_TRUE(arena.getMemoryMngr(1)->resize(1024));
+    EXPECT_FALSE(arena.getMemoryMngr(1)->hasExtBuffer());
+}
+
+TEST(DynamicMemoryArenaTest, PlanPerSignature) {
+    DynamicMemoryArena arena(testBoxes, 4);
+    const DynamicMemoryArena::Signature small = {{1, 10}};
+    const DynamicMemoryArena::Signature large = {{1, 1000}};
+
+    arena.update(small, {64, 64, 64});
+    arena.update(large, {6400, 6400, 6400});
+
+    arena.prepare(small);
+    EXPECT_EQ(arena.getArenaSize(), 128u);
+
+    arena.prepare(large);
+    EXPECT_EQ(arena.getArenaSize(), 12800u);
+
+    // the arena never shrinks, the small placement is applied inside the same block
+    arena.prepare(small);
+    EXPECT_EQ(arena.getArenaSize(), 12800u);
+    EXPECT_EQ(rawPtr(arena, 0), rawPtr(arena, 2));
+    EXPECT_NE(rawPtr(arena, 0), rawPtr(arena, 1));
+}
@@ -18,15 +18,34 @@
 #include "../../../ie_test_utils/common_test_utils/common_utils.hpp"
 #include "cache/multi_cache.h"
 #include "nodes/input.h"
+#include "utils/bfloat16.hpp"
 
 using namespace InferenceEngine;
 using namespace ov::intel_cpu;
 namespace ReorderCPUTest {
+inline float getValue(const void* data, size_t offset, const InferenceEngine::Precision& prec) {
+    switch (prec) {
+    case InferenceEngine::Precision::FP32:
+        return *(static_cast<const float*>(data) + offset);
+    case InferenceEngine::Precision::BF16:
+        return static_cast<float>(*(static_cast<const ov::intel_cpu::bfloat16_t*>(data) + offset));
+    case InferenceEngine::Precision::I32:
+        return static_cast<float>(*(static_cast<const int32_t*>(data) + offset));
+    case InferenceEngine::Precision::I8:
+        return static_cast<float>(*(static_cast<const int8_t*>(data) + offset));
+    case InferenceEngine::Precision::U8:
+        return static_cast<float>(*(static_cast<const uint8_t*>(data) + offset));
+    default:
+        IE_THROW() << "Unsupported data precision in the test " << prec.name();
+    }
+}
+
 inline void checkReorder(const ov::intel_cpu::Memory& inputMemory,
-                         const ov::intel_cpu::Memory& outputMemory,
-                         const InferenceEngine::Precision& prescision) {
+                         const ov::intel_cpu::Memory& outputMemory) {
     auto srcData = inputMemory.GetData();
     auto dstData = outputMemory.GetData();
+    const auto srcPrec = inputMemory.getDesc().getPrecision();
+    const auto dstPrec = outputMemory.getDesc().getPrecision();
     auto mdInput = inputMemory.GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
     auto mdOutput = outputMemory.GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
 
@@ -34,25 +53,12 @@ inline void checkReorder(const ov::intel_cpu::Memory& inputMemory,
     const dnnl::impl::memory_desc_wrapper mdwOutput(mdOutput.data);
     auto nelems = mdwInput.nelems();
 
+    // the destination precision is always able to represent the source values exactly
     for (size_t i = 0; i < nelems; ++i) {
         auto srcOffset = mdwInput.off_l(i, false);
         auto dstOffset = mdwOutput.off_l(i, false);
-        switch (prescision) {
-        case InferenceEngine::Precision::FP32: {
-            auto s = *(static_cast<float*>(srcData) + srcOffset);
-            auto d = *(static_cast<float*>(dstData) + dstOffset);
-            ASSERT_EQ(s, d) << "mismatch at position " << i;
-            break;
-        }
-        case InferenceEngine::Precision::I8: {
-            auto s = *(static_cast<int8_t*>(srcData) + srcOffset);
-            auto d = *(static_cast<int8_t*>(dstData) + dstOffset);
-            ASSERT_EQ(s, d) << "mismatch at position " << i;
-            break;
-        }
-        default:
-            FAIL() << "Unsupported data precision in the test" << prescision.name();
-        }
+        ASSERT_EQ(getValue(srcData, srcOffset, srcPrec), getValue(dstData, dstOffset, dstPrec))
+            << "mismatch at position " << i;
     }
 }
 
@@ -78,10 +84,23 @@ inline void fillData(const ov::intel_cpu::Memory& inputMemory, const InferenceEn
         for (size_t i = 0; i < elemNum; ++i)
             *(static_cast<float*>(inputReorderData) + mdInput.off_l(i, false)) = static_cast<float>(i);
         break;
+    case InferenceEngine::Precision::BF16:
+        for (size_t i = 0; i < elemNum; ++i)
+            *(static_cast<ov::intel_cpu::bfloat16_t*>(inputReorderData) + mdInput.off_l(i, false)) =
+                static_cast<float>(i % 256);
+        break;
+    case InferenceEngine::Precision::I32:
+        for (size_t i = 0; i < elemNum; ++i)
+            *(static_cast<int32_t*>(inputReorderData) + mdInput.off_l(i, false)) = static_cast<int32_t>(i) - 1000;
+        break;
     case InferenceEngine::Precision::I8:
         for (size_t i = 0; i < elemNum; ++i)
             *(static_cast<int8_t*>(inputReorderData) + mdInput.off_l(i, false)) = static_cast<int8_t>(i);
         break;
+    case InferenceEngine::Precision::U8:
+        for (size_t i = 0; i < elemNum; ++i)
+            *(static_cast<uint8_t*>(inputReorderData) + mdInput.off_l(i, false)) = static_cast<uint8_t>(i);
+        break;
     default:
         FAIL() << "Unsupported data precision in the test" << prec.name();
     }
@@ -102,6 +121,8 @@ struct ReorderCPUTestParamSet {
     LayoutType srcLayout;
     LayoutType dstLayout;
     InferenceEngine::Precision prec;
+    // the precision conversion fused into the reorder, the same as the input precision if not set
+    InferenceEngine::Precision dstPrec;
 };
 
 class ReorderCPUTestGraph {
@@ -267,7 +288,7 @@ protected:
     }
 
     void validate(void) {
-        checkReorder(parentEdge->getMemory(), childEdge->getMemory(), prec);
+        checkReorder(parentEdge->getMemory(), childEdge->getMemory());
     }
 
     // Fill srcData so that the results of NSPC2NCSP and NCSP2NSPC reorders are incremental numbers 0,1,2,...
@@ -327,7 +348,7 @@ public:
         result << "_InputLayoutType:" << layoutName(p.srcLayout) << ".";
         result << "_OutputLayoutType:" << layoutName(p.dstLayout) << ".";
         result << "_InputDataType:" << p.prec.name();
-        result << "_OutputDataType:" << p.prec.name();
+        result << "_OutputDataType:" << (p.dstPrec == InferenceEngine::Precision::UNSPECIFIED ? p.prec : p.dstPrec).name();
         result << ")";
         return result.str();
     }
@@ -349,7 +370,7 @@ protected:
         reorderNode->executeDynamic(stream);
     }
     void validate(void) {
-        checkReorder(parentEdge->getMemory(), childEdge->getMemory(), prec);
+        checkReorder(parentEdge->getMemory(), childEdge->getMemory());
     }
 
     struct BuildReorderParams {
@@ -368,6 +389,7 @@ protected:
         reorderParams.dstShape = reorderParams.srcShape;
         inputShapes = reorderTestParam.inputShapes;
         prec = reorderTestParam.prec;
+        dstPrec = reorderTestParam.dstPrec == InferenceEngine::Precision::UNSPECIFIED ? prec : reorderTestParam.dstPrec;
 
         buildReorderDynamismGraph(reorderParams);
     }
@@ -381,13 +403,14 @@ protected:
             srcBlockedDescCreator->createDesc(prec, reorderParams.srcShape);
 
         const ov::intel_cpu::CpuBlockedMemoryDesc outputDesc =
-            dstBlockedDescCreator->createDesc(prec, reorderParams.dstShape);
+            dstBlockedDescCreator->createDesc(dstPrec, reorderParams.dstShape);
 
         buildReorderGraph(inputDesc, outputDesc);
     }
 
 private:
     std::vector<std::vector<size_t>> inputShapes;
+    InferenceEngine::Precision dstPrec;
 };
 
 TEST_P(ReorderDynamismCPUTest, CompareResult) {
@@ -414,7 +437,54 @@ const auto reorderCpuTestDynamismParams =
                                              {{2, 32, 3, 4}, {2, 32, 6, 4}, {2, 32, 3, 4}},
                                              LayoutType::nCsp16c,
                                              LayoutType::nspc,
-                                             InferenceEngine::Precision::I8});
+                                             InferenceEngine::Precision::I8},
+                      // the channels are not aligned to the block and the tiles of the transposing reorder
+                      ReorderCPUTestParamSet{{-1, 20, -1, -1},
+                                             {{2, 20, 3, 5}, {1, 20, 9, 15}, {2, 20, 3, 5}},
+                                             LayoutType::ncsp,
+                                             LayoutType::nCsp16c,
+                                             InferenceEngine::Precision::FP32},
+                      ReorderCPUTestParamSet{{-1, 20, -1, -1},
+                                             {{2, 20, 3, 5}, {1, 20, 9, 15}, {2, 20, 3, 5}},
+                                             LayoutType::nCsp8c,
+                                             LayoutType::ncsp,
+                                             InferenceEngine::Precision::I8},
+                      ReorderCPUTestParamSet{{-1, -1, -1, -1},
+                                             {{2, 3, 7, 7}, {1, 70, 3, 5}, {2, 3, 7, 7}},
+                                             LayoutType::nspc,
+                                             LayoutType::ncsp,
+                                             InferenceEngine::Precision::I8},
+                      // the precision conversion is fused into the reorder (see MergeConvertAndReorder)
+                      ReorderCPUTestParamSet{{-1, 20, -1, -1},
+                                             {{2, 20, 3, 5}, {1, 20, 9, 15}, {2, 20, 3, 5}},
+                                             LayoutType::ncsp,
+                                             LayoutType::nCsp16c,
+                                             InferenceEngine::Precision::U8,
+                                             InferenceEngine::Precision::FP32},
+                      ReorderCPUTestParamSet{{-1, 20, -1, -1},
+                                             {{2, 20, 3, 5}, {1, 20, 9, 15}, {2, 20, 3, 5}},
+                                             LayoutType::nspc,
+                                             LayoutType::ncsp,
+                                             InferenceEngine::Precision::I8,
+                                             InferenceEngine::Precision::FP32},
+                      ReorderCPUTestParamSet{{-1, 20, -1, -1},
+                                             {{2, 20, 3, 5}, {1, 20, 9, 15}, {2, 20, 3, 5}},
+                                             LayoutType::nCsp8c,
+                                             LayoutType::nspc,
+                                             InferenceEngine::Precision::I32,
+                                             InferenceEngine::Precision::FP32},
+                      ReorderCPUTestParamSet{{-1, 20, -1, -1},
+                                             {{2, 20, 3, 5}, {1, 20, 9, 15}, {2, 20, 3, 5}},
+                                             LayoutType::ncsp,
+                                             LayoutType::nspc,
+                                             InferenceEngine::Precision::BF16,
+                                             InferenceEngine::Precision::FP32},
+                      ReorderCPUTestParamSet{{-1, 20, -1, -1},
+                                             {{2, 20, 3, 5}, {1, 20, 9, 15}, {2, 20, 3, 5}},
+                                             LayoutType::nCsp16c,
+                                             LayoutType::ncsp,
+                                             InferenceEngine::Precision::U8,
+                                             InferenceEngine::Precision::I32});
 
 INSTANTIATE_TEST_SUITE_P(smoke_ReorderTestDynamism,
                          ReorderDynamismCPUTest,
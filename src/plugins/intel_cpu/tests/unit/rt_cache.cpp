@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -9,6 +10,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
 
 using namespace ov::intel_cpu;
 
@@ -379,3 +381,139 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(ShardedLruCacheTests, SingleShardLruPolicy) {
+    constexpr int capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity, 1);
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 25; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    ASSERT_EQ(cache.getEvictionsCount(), 3u);
+}
+
+TEST(ShardedLruCacheTests, Capacity) {
+    constexpr size_t capacity = 64;
+    constexpr size_t shards = 8;
+    ShardedLruCache<IntKey, int> cache(capacity, shards);
+    ASSERT_EQ(cache.getCapacity(), capacity);
+
+    constexpr int keysCount = 4 * capacity;
+    for (int i = 0; i < keysCount; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    size_t stored = 0;
+    for (int i = 0; i < keysCount; ++i) {
+        if (cache.get({i}) != int())
+            ++stored;
+    }
+    ASSERT_LE(stored, capacity);
+    ASSERT_EQ(stored + cache.getEvictionsCount(), 4 * capacity);
+}
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr int capacity = 10;
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        auto result = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+
+    const auto stat = cache.getStatistics();
+    ASSERT_EQ(stat.misses, 2u * capacity);
+    ASSERT_EQ(stat.hits, static_cast<size_t>(capacity));
+    ASSERT_EQ(stat.evictions, static_cast<size_t>(capacity));
+}
+
+TEST(MultiCacheTests, SmokeSharedBetweenThreads) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr size_t capacity = 1000;
+    constexpr size_t numThreads = 16;
+    constexpr int numKeys = 50;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity, numThreads);
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < numKeys; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+            auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+            ASSERT_NE(strResult.first, StrValueType());
+            ASSERT_EQ(*strResult.first, std::to_string(i));
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    // all the keys fit the cache, so once the values are created by any thread the others must hit
+    for (int i = 0; i < numKeys; ++i) {
+        ASSERT_EQ(cache.getOrCreate(IntKey{i}, intBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+        ASSERT_EQ(cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+    }
+
+    const auto stat = cache.getStatistics();
+    ASSERT_EQ(stat.hits + stat.misses, 2u * numKeys * (numThreads + 1));
+    ASSERT_EQ(stat.evictions, 0u);
+}
+
+TEST(MultiCacheTests, JitKernelsSharedBetweenGraphCaches) {
+    // a key type used by this test only, so the process wide cache doesn't contain its records yet
+    struct KernelKey {
+        size_t hash() const {
+            return std::hash<int>().operator()(data);
+        }
+        bool operator==(const KernelKey& rhs) const noexcept {
+            return this->data == rhs.data;
+        }
+
+        int data;
+    };
+
+    std::atomic<int> builds{0};
+    auto kernelBuilder = [&](const KernelKey& key) {
+        builds++;
+        return std::make_shared<int>(key.data);
+    };
+    auto sharedBuilder = [&](const KernelKey& key) {
+        return getJitKernelsCache().getOrCreate(key, kernelBuilder).first;
+    };
+
+    // the runtime caches of two different compiled models
+    MultiCache firstGraphCache(10), secondGraphCache(10);
+    auto first = firstGraphCache.getOrCreate(KernelKey{42}, sharedBuilder);
+    auto second = secondGraphCache.getOrCreate(KernelKey{42}, sharedBuilder);
+
+    ASSERT_EQ(first.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(second.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(first.first, second.first);
+    ASSERT_EQ(builds, 1);
+}
@@ -13,6 +13,7 @@
 #include "ngraph/ops.hpp"
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 #include "cpp/ie_cnn_network.h"
@@ -403,6 +404,54 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+static std::shared_ptr<ngraph::Function> create_function_with_weights(
+        const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights, int64_t softmaxAxis = 1) {
+    // Parameter--->Add--->Softmax--->Result
+    //  Constant---'
+    const ngraph::Shape shape{4, weights->size() / (4 * sizeof(float))};
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, shape);
+    auto view = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+        weights->get_ptr<char>(), weights->size(), weights);
+    auto constant = std::make_shared<ngraph::opset6::Constant>(ngraph::element::f32, shape, view);
+    auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+    auto softmax = std::make_shared<ngraph::opset6::Softmax>(add, softmaxAxis);
+    auto res = std::make_shared<ngraph::opset6::Result>(softmax);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data});
+}
+
+static std::shared_ptr<ngraph::runtime::AlignedBuffer> create_weights(float value) {
+    // large enough to be hashed by several chunks
+    const size_t count = 3 * 1024 * 1024;
+    auto weights = std::make_shared<ngraph::runtime::AlignedBuffer>(count * sizeof(float));
+    std::fill_n(weights->get_ptr<float>(), count, value);
+    return weights;
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstants) {
+    auto weights1 = create_weights(1.f);
+    auto weights2 = create_weights(1.f);
+    auto weights3 = create_weights(2.f);
+    auto net1 = CNNNetwork(create_function_with_weights(weights1));
+    auto net2 = CNNNetwork(create_function_with_weights(weights2));
+    auto net3 = CNNNetwork(create_function_with_weights(weights3));
+
+    // the second calculation reuses the hash of the same weights
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net1, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentAttributes) {
+    auto weights = create_weights(1.f);
+    auto net1 = CNNNetwork(create_function_with_weights(weights, 1));
+    auto net2 = CNNNetwork(create_function_with_weights(weights, 0));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
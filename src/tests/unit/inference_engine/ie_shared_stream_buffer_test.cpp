@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <string>
+
+#include "ie_shared_stream_buffer.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::shared_ptr<ngraph::runtime::AlignedBuffer> makeBuffer(const std::string& content) {
+    auto buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(content.size());
+    std::memcpy(buffer->get_ptr(), content.data(), content.size());
+    return buffer;
+}
+
+}  // namespace
+
+TEST(SharedStreamBufferTests, canReadWholeBuffer) {
+    SharedStreamBuffer streamBuffer(makeBuffer("0123456789"));
+    std::istream stream(&streamBuffer);
+
+    std::string content(10, '\0');
+    stream.read(&content[0], content.size());
+    ASSERT_TRUE(stream.good());
+    ASSERT_EQ(content, "0123456789");
+    ASSERT_EQ(stream.get(), std::char_traits<char>::eof());
+    ASSERT_TRUE(stream.eof());
+}
+
+TEST(SharedStreamBufferTests, canSeekAndTell) {
+    SharedStreamBuffer streamBuffer(makeBuffer("0123456789"));
+    std::istream stream(&streamBuffer);
+
+    stream.seekg(4);
+    ASSERT_EQ(stream.tellg(), 4);
+    ASSERT_EQ(stream.get(), '4');
+
+    stream.seekg(2, std::ios_base::cur);
+    ASSERT_EQ(stream.tellg(), 7);
+    ASSERT_EQ(stream.get(), '7');
+
+    stream.seekg(-1, std::ios_base::end);
+    ASSERT_EQ(stream.tellg(), 9);
+    ASSERT_EQ(stream.get(), '9');
+}
+
+TEST(SharedStreamBufferTests, seekOutOfBoundsFails) {
+    SharedStreamBuffer streamBuffer(makeBuffer("0123456789"));
+    std::istream stream(&streamBuffer);
+
+    stream.seekg(11);
+    ASSERT_TRUE(stream.fail());
+}
+
+TEST(SharedStreamBufferTests, canBeRecognizedByStream) {
+    auto buffer = makeBuffer("0123456789");
+    SharedStreamBuffer streamBuffer(buffer);
+    std::istream stream(&streamBuffer);
+
+    auto sharedStreamBuffer = dynamic_cast<SharedStreamBuffer*>(stream.rdbuf());
+    ASSERT_NE(sharedStreamBuffer, nullptr);
+    ASSERT_EQ(sharedStreamBuffer->getBuffer(), buffer);
+}